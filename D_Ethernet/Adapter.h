@@ -1,6 +1,6 @@
 
 // Author    KMS - Martin Dubois, P. Eng.
-// Copyright (C) 2025 KMS
+// Copyright (C) 2025-2026 KMS
 // License   http://www.apache.org/licenses/LICENSE-2.0
 // Product   DrvDMS-Sample
 // File      D_Ethernet/Adapter.h
@@ -11,18 +11,38 @@
 #include <linux/mii.h>
 #include <linux/pci.h>
 
+// ===== Local ==============================================================
+#include "Loopback.h"
+#include "RxRing.h"
+#include "TxRing.h"
+
 typedef struct
 {
     struct net_device* mNetDev;
-    struct pci_dev   * mPciDev;
+    struct pci_dev   * mPciDev; // NULL for the loopback interface
 
     uint32_t mMsgLevel;
+
+    // NOTE  The loopback engine takes the place of the H2C and C2H
+    //       channels of the DrvDMA device.
+    Loopback mLoopback;
+
+    struct napi_struct mNapi;
+
+    RxRing mRx;
+    TxRing mTx;
 }
 Adapter;
 
 // Functions
 // //////////////////////////////////////////////////////////////////////////
 
-extern void Adapter_Create(Adapter* aThis, struct pci_dev* aPciDev);
+// aPciDev  NULL for the loopback interface
+//
+// Return
+//  0
+//  ...  See register_netdev. The adapter is not created and
+//       Adapter_Destroy must not be called.
+extern int Adapter_Create(Adapter* aThis, struct pci_dev* aPciDev);
 
 extern void Adapter_Destroy(Adapter* aThis);
@@ -1,6 +1,6 @@
 
 // Author    KMS - Martin Dubois, P. Eng.
-// Copyright (C) 2025 KMS
+// Copyright (C) 2025-2026 KMS
 // License   http://www.apache.org/licenses/LICENSE-2.0
 // Product   DrvDMS-Sample
 // File      D_Ethernet/Adapter_L.c
@@ -19,11 +19,22 @@
 
 static const uint8_t ETHERNET_ADDRESS[] = { 0x04, 0x05, 0x06, 0x07, 0x08, 0x09 };
 
+// A frame uses one descriptor per fragment. StartXmit stops the queue
+// when a frame with the maximum fragment count may not fit anymore and the
+// NAPI poll wakes it when twice that is free, so the queue does not toggle
+// at each frame.
+#define TX_STOP_QTY (MAX_SKB_FRAGS + 1)
+#define TX_WAKE_QTY (2 * TX_STOP_QTY)
+
 #define WATCHDOG_tick (2 * HZ)
 
 // Static function declarations
 // //////////////////////////////////////////////////////////////////////////
 
+static int RxReceive(Adapter* aThis, int aBudget);
+
+static void TxComplete(Adapter* aThis, int aBudget);
+
 // ===== Entry points - EthTool =============================================
 static uint32_t GetMsgLevel (struct net_device* aNetDev);
 static int      GetSSetCount(struct net_device* aNetDev, int aSSet);
@@ -42,6 +53,9 @@ static void TxTimeout    (struct net_device* aNetDev, unsigned int aTxQueue);
 
 static netdev_tx_t StartXmit(struct sk_buff* aBuffer, struct net_device* aNetDev);
 
+// ===== Entry points - NAPI ================================================
+static int Poll(struct napi_struct* aNapi, int aBudget);
+
 // Static variables
 // //////////////////////////////////////////////////////////////////////////
 
@@ -74,7 +88,7 @@ static const struct net_device_ops sOperations_NetDev =
 // Functions
 // //////////////////////////////////////////////////////////////////////////
 
-void Adapter_Create(Adapter* aThis, struct pci_dev* aPciDev)
+int Adapter_Create(Adapter* aThis, struct pci_dev* aPciDev)
 {
     printk(KERN_DEBUG PREFIX "%s( ,  )\n", __FUNCTION__);
 
@@ -83,7 +97,8 @@ void Adapter_Create(Adapter* aThis, struct pci_dev* aPciDev)
     struct net_device* lNetDev = aThis->mNetDev;
 
     lNetDev->ethtool_ops    = &sOperations_EthTool;
-    lNetDev->hw_features   |= NETIF_F_RXALL | NETIF_F_RXFCS;
+    lNetDev->features      |= NETIF_F_SG;
+    lNetDev->hw_features   |= NETIF_F_RXALL | NETIF_F_RXFCS | NETIF_F_SG;
     lNetDev->netdev_ops     = &sOperations_NetDev;
     lNetDev->priv_flags    |= IFF_SUPP_NOFCS;
     lNetDev->watchdog_timeo = WATCHDOG_tick;
@@ -93,12 +108,18 @@ void Adapter_Create(Adapter* aThis, struct pci_dev* aPciDev)
     // NOTE  Use a real ethernet address
     eth_hw_addr_set(lNetDev, ETHERNET_ADDRESS);
 
-    int lRet = register_netdev(lNetDev);
-    if (0 != lRet)
+    Loopback_Init(&aThis->mLoopback, &aThis->mRx, &aThis->mTx, &aThis->mNapi);
+
+    netif_napi_add(lNetDev, &aThis->mNapi, Poll);
+
+    int lResult = register_netdev(lNetDev);
+    if (0 != lResult)
     {
-        printk(KERN_ERR PREFIX "%s - register_netdev(  ) failed - %d\n", __FUNCTION__, lRet);
-        return;
+        printk(KERN_ERR PREFIX "%s - register_netdev(  ) failed - %d\n", __FUNCTION__, lResult);
+        netif_napi_del(&aThis->mNapi);
     }
+
+    return lResult;
 }
 
 void Adapter_Destroy(Adapter* aThis)
@@ -106,11 +127,63 @@ void Adapter_Destroy(Adapter* aThis)
     printk(KERN_DEBUG PREFIX "%s( ,  )\n", __FUNCTION__);
 
     unregister_netdev(aThis->mNetDev);
+
+    netif_napi_del(&aThis->mNapi);
 }
 
 // Static functions
 // //////////////////////////////////////////////////////////////////////////
 
+// Pass the received frames to the stack, then post new buffers, so the
+// engine gets them back as soon as possible. The refill also retries the
+// allocations a previous poll failed.
+int RxReceive(Adapter* aThis, int aBudget)
+{
+    struct net_device* lNetDev = aThis->mNetDev;
+
+    unsigned int lBytes;
+    int          lResult = RxRing_Receive(&aThis->mRx, &aThis->mNapi, aBudget, &lBytes);
+
+    lNetDev->stats.rx_bytes   += lBytes;
+    lNetDev->stats.rx_packets += lResult;
+
+    if (0 < RxRing_Refill(&aThis->mRx, GFP_ATOMIC))
+    {
+        Loopback_RxKick(&aThis->mLoopback, aThis->mRx.mHead);
+    }
+
+    lNetDev->stats.rx_missed_errors = READ_ONCE(aThis->mLoopback.mRxMissed);
+
+    return lResult;
+}
+
+// Reclaim the transmitted frames, report them to BQL and wake the queue
+// StartXmit stopped, unless the interface is closing.
+void TxComplete(Adapter* aThis, int aBudget)
+{
+    struct net_device  * lNetDev = aThis->mNetDev;
+    struct netdev_queue* lQueue  = netdev_get_tx_queue(lNetDev, 0);
+
+    unsigned int lBytes;
+    unsigned int lPackets = TxRing_Clean(&aThis->mTx, aBudget, &lBytes);
+
+    if (0 < lPackets)
+    {
+        netdev_tx_completed_queue(lQueue, lPackets, lBytes);
+
+        lNetDev->stats.tx_bytes   += lBytes;
+        lNetDev->stats.tx_packets += lPackets;
+
+        // StartXmit stops the queue, then reads the free count.
+        smp_mb();
+
+        if (netif_running(lNetDev) && netif_tx_queue_stopped(lQueue) && (TX_WAKE_QTY <= TxRing_GetFree(&aThis->mTx)))
+        {
+            netif_tx_wake_queue(lQueue);
+        }
+    }
+}
+
 // ===== Entry points - EthTool =============================================
 
 uint32_t GetMsgLevel(struct net_device* aNetDev)
@@ -174,8 +247,37 @@ int EthIoCtl(struct net_device* aNetDev, struct ifreq* aRequest, int aCmd)
 int Open(struct net_device* aNetDev)
 {
     printk(KERN_DEBUG PREFIX "%s(  )\n", __FUNCTION__);
-    
-    return 0;
+
+    Adapter* lThis = netdev_priv(aNetDev);
+
+    // NOTE  The loopback engine copies the frames using the CPU, so the
+    //       rings do not map the buffers. With the DMA channels, use
+    //       &lThis->mPciDev->dev.
+    struct device* lDmaDev = NULL;
+
+    int lResult = TxRing_Init(&lThis->mTx, lDmaDev);
+    if (0 == lResult)
+    {
+        lResult = RxRing_Init(&lThis->mRx, aNetDev, lDmaDev);
+        if (0 != lResult)
+        {
+            TxRing_Uninit(&lThis->mTx);
+            return lResult;
+        }
+
+        netdev_reset_queue(aNetDev);
+
+        Loopback_Start(&lThis->mLoopback);
+
+        napi_enable(&lThis->mNapi);
+
+        Loopback_IntEnable(&lThis->mLoopback);
+
+        netif_carrier_on(aNetDev);
+        netif_start_queue(aNetDev);
+    }
+
+    return lResult;
 }
 
 int SetFeatures(struct net_device* aNetDev, netdev_features_t aFeatures)
@@ -208,21 +310,115 @@ void SetRxMode(struct net_device* aNetDev)
     printk(KERN_DEBUG PREFIX "%s(  )\n", __FUNCTION__);
 }
 
+// The frames the engine completed are reclaimed, TxRing_Uninit drops the
+// others.
 int Stop(struct net_device* aNetDev)
 {
     printk(KERN_DEBUG PREFIX "%s(  )\n", __FUNCTION__);
 
+    Adapter* lThis = netdev_priv(aNetDev);
+
+    netif_carrier_off(aNetDev);
+    netif_tx_disable(aNetDev);
+
+    Loopback_Stop(&lThis->mLoopback);
+
+    napi_disable(&lThis->mNapi);
+
+    TxComplete(lThis, 0);
+
+    RxRing_Uninit(&lThis->mRx);
+    TxRing_Uninit(&lThis->mTx);
+
+    netdev_reset_queue(aNetDev);
+
     return 0;
 }
 
 void TxTimeout(struct net_device* aNetDev, unsigned int aTxQueue)
 {
     printk(KERN_DEBUG PREFIX "%s( ,  )\n", __FUNCTION__);
+
+    Adapter* lThis = netdev_priv(aNetDev);
+
+    printk(KERN_WARNING PREFIX "%s - Head = %u, Tail = %u\n", __FUNCTION__, READ_ONCE(lThis->mTx.mHead), READ_ONCE(lThis->mTx.mTail));
 }
 
+// Called for each frame, without trace. With xmit_more, the stack has more
+// frames to send right away and the doorbell waits for the last one, unless
+// the queue stopped.
 netdev_tx_t StartXmit(struct sk_buff* aBuffer, struct net_device* aNetDev)
 {
-    printk(KERN_DEBUG PREFIX "%s( ,  )\n", __FUNCTION__);
+    Adapter* lThis = netdev_priv(aNetDev);
+
+    struct netdev_queue* lQueue = netdev_get_tx_queue(aNetDev, 0);
+
+    unsigned int lSize_byte = aBuffer->len;
+
+    // The queue stops before the ring is full, so it should not happen.
+    if (unlikely(TxRing_GetFree(&lThis->mTx) < skb_shinfo(aBuffer)->nr_frags + 1U))
+    {
+        printk(KERN_ERR PREFIX "%s - Ring full\n", __FUNCTION__);
+        netif_tx_stop_queue(lQueue);
+        return NETDEV_TX_BUSY;
+    }
+
+    if (0 != TxRing_Post(&lThis->mTx, aBuffer))
+    {
+        dev_kfree_skb_any(aBuffer);
+        DEV_STATS_INC(aNetDev, tx_dropped);
+
+        // A previous frame may wait for this doorbell.
+        if (!netdev_xmit_more())
+        {
+            Loopback_TxKick(&lThis->mLoopback, lThis->mTx.mHead);
+        }
+    }
+    else
+    {
+        if (unlikely(TX_STOP_QTY > TxRing_GetFree(&lThis->mTx)))
+        {
+            netif_tx_stop_queue(lQueue);
+
+            // The NAPI poll reclaims, then reads the stopped state.
+            smp_mb();
+
+            if (TX_WAKE_QTY <= TxRing_GetFree(&lThis->mTx))
+            {
+                netif_tx_start_queue(lQueue);
+            }
+        }
+
+        if (__netdev_tx_sent_queue(lQueue, lSize_byte, netdev_xmit_more()))
+        {
+            Loopback_TxKick(&lThis->mLoopback, lThis->mTx.mHead);
+        }
+    }
 
     return NETDEV_TX_OK;
 }
+
+// ===== Entry points - NAPI ================================================
+
+// The interrupt stays disabled while the poll uses all its budget, the
+// NAPI softirq calls it again. Under the budget, the poll completes and
+// enables the interrupt, unless the busy polling or the deferral of
+// napi_defer_hard_irqs keeps the NAPI instance scheduled. The transmit
+// completions do not count in the budget. A budget of 0 comes from
+// netpoll, which only wants the transmit completions, and the poll must
+// not complete.
+int Poll(struct napi_struct* aNapi, int aBudget)
+{
+    Adapter* lThis = container_of(aNapi, Adapter, mNapi);
+
+    TxComplete(lThis, aBudget);
+
+    int lResult = RxReceive(lThis, aBudget);
+
+    if ((aBudget > lResult) && napi_complete_done(aNapi, lResult))
+    {
+        Loopback_IntEnable(&lThis->mLoopback);
+    }
+
+    return lResult;
+}
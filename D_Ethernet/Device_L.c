@@ -35,6 +35,8 @@ DeviceContext;
 
 static unsigned int sDeviceCount = 0;
 
+static struct net_device* sLoopback = NULL;
+
 static struct file_operations sOperations =
 {
     .owner          = THIS_MODULE,
@@ -77,7 +79,14 @@ int Device_Create(struct pci_dev* aDev, unsigned int aMajor, unsigned int aMinor
 
                 lThis->mAdapter->mNetDev = lThis->mNetDevice;
 
-                Adapter_Create(lThis->mAdapter, aDev);
+                lResult = Adapter_Create(lThis->mAdapter, aDev);
+                if (0 != lResult)
+                {
+                    pci_set_drvdata(aDev, NULL);
+                    free_netdev(lThis->mNetDevice);
+                    DrvDMA_Device_ReleaseHardware(&lThis->mDrvDMA_Device);
+                    sDeviceCount--;
+                }
             }
             else
             {
@@ -126,3 +135,42 @@ void Device_Destroy(struct pci_dev* aDev)
 
     kfree(lThis);
 }
+
+int Device_CreateLoopback()
+{
+    printk(KERN_DEBUG PREFIX "%s()\n", __FUNCTION__);
+
+    sLoopback = alloc_etherdev(sizeof(Adapter));
+    if (NULL == sLoopback)
+    {
+        printk(KERN_ERR PREFIX "%s - ENOMEM\n", __FUNCTION__);
+        return - ENOMEM;
+    }
+
+    Adapter* lAdapter = netdev_priv(sLoopback);
+
+    lAdapter->mNetDev = sLoopback;
+
+    int lResult = Adapter_Create(lAdapter, NULL);
+    if (0 != lResult)
+    {
+        free_netdev(sLoopback);
+        sLoopback = NULL;
+    }
+
+    return lResult;
+}
+
+void Device_DestroyLoopback()
+{
+    printk(KERN_DEBUG PREFIX "%s()\n", __FUNCTION__);
+
+    if (NULL != sLoopback)
+    {
+        Adapter_Destroy(netdev_priv(sLoopback));
+
+        free_netdev(sLoopback);
+
+        sLoopback = NULL;
+    }
+}
@@ -13,3 +13,14 @@
 extern int Device_Create(struct pci_dev* aDev, unsigned int aMajor, unsigned int aMinor, struct class* aClass);
 
 extern void Device_Destroy(struct pci_dev* aDev);
+
+// An interface using the loopback engine, without PCI device, to measure
+// the driver on a computer without the FPGA
+//
+// Return
+//  0
+//  - ENOMEM
+//  ...       See register_netdev
+extern int Device_CreateLoopback(void);
+
+extern void Device_DestroyLoopback(void);
@@ -61,6 +61,14 @@ static dev_t sChrDev;
 
 static struct class * sClass = NULL;
 
+// Module parameters
+// //////////////////////////////////////////////////////////////////////////
+
+static bool loopback = false;
+
+module_param(loopback, bool, 0444);
+MODULE_PARM_DESC(loopback, "Also create an interface using the loopback engine, without PCI device");
+
 // Static functions
 // //////////////////////////////////////////////////////////////////////////
 
@@ -80,6 +88,8 @@ void Exit()
 {
     printk(KERN_DEBUG PREFIX "%s()\n", __FUNCTION__);
 
+    Device_DestroyLoopback();
+
     pci_unregister_driver(&sPciDriver);
 
     unregister_chrdev_region(sChrDev, DEVICE_COUNT_MAX);
@@ -120,6 +130,16 @@ int Init()
                 unregister_chrdev_region(sChrDev, DEVICE_COUNT_MAX);
                 lResult = __LINE__;
             }
+            else if (loopback)
+            {
+                lRet = Device_CreateLoopback();
+                if (0 != lRet)
+                {
+                    pci_unregister_driver(&sPciDriver);
+                    unregister_chrdev_region(sChrDev, DEVICE_COUNT_MAX);
+                    lResult = lRet;
+                }
+            }
         }
 
         if (0 != lResult)
@@ -0,0 +1,72 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMS-Sample
+// File      D_Ethernet/Loopback.h
+
+#pragma once
+
+// ===== Linux kernel =======================================================
+#include <linux/netdevice.h>
+#include <linux/workqueue.h>
+
+// ===== Local ==============================================================
+#include "RxRing.h"
+#include "TxRing.h"
+
+// A software engine with the behavior of a pair of DMA channels. The
+// doorbells give it the new heads of the rings, a work item marks the
+// transmit descriptors done, in order, then raises the interrupt. Before
+// completing the last descriptor of a frame, it copies the frame into the
+// next receive buffer, so each transmitted frame is also received. It
+// writes the buffer using the address of the sk_buff, so the rings must not
+// map the buffers for a device. As with a MSI-X vector configured to
+// auto mask, raising the interrupt disables it and the NAPI poll enables
+// it again when it completes. A completion while the interrupt is disabled
+// stays pending until then.
+typedef struct
+{
+    struct napi_struct* mNapi; // Scheduled by the interrupt
+    RxRing            * mRx;
+    TxRing            * mTx;
+
+    struct work_struct mWork;
+
+    // Protect mIntEnabled and mIntPending
+    spinlock_t mLock;
+
+    bool mIntEnabled;
+    bool mIntPending;
+
+    unsigned int mRxHead; // Written by the doorbell
+    unsigned int mRxNext; // Next buffer the work item fills
+    unsigned int mTxHead; // Written by the doorbell
+    unsigned int mTxNext; // Next descriptor the work item completes
+
+    // The frames lost because no receive buffer was posted or the frame was
+    // too large. Only the work item writes it.
+    unsigned long mRxMissed;
+}
+Loopback;
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+// Called once, at creation of the adapter
+extern void Loopback_Init(Loopback* aThis, RxRing* aRx, TxRing* aTx, struct napi_struct* aNapi);
+
+// Enable the interrupt, raise it if a completion is pending
+extern void Loopback_IntEnable(Loopback* aThis);
+
+// The rings must be initialized, the transmit ring empty
+extern void Loopback_Start(Loopback* aThis);
+
+// Disable the interrupt and wait for the work item. The descriptors not
+// completed stay in the ring.
+extern void Loopback_Stop(Loopback* aThis);
+
+// The doorbells
+//
+// aHead  The new head of the ring
+extern void Loopback_RxKick(Loopback* aThis, unsigned int aHead);
+extern void Loopback_TxKick(Loopback* aThis, unsigned int aHead);
@@ -0,0 +1,191 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMS-Sample
+// File      D_Ethernet/Loopback_L.c
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "Loopback.h"
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static void Interrupt_Raise(Loopback* aThis);
+
+static void Rx_Write(Loopback* aThis, const struct sk_buff* aSkb);
+
+// ===== Entry points =======================================================
+static void Work(struct work_struct* aWork);
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+void Loopback_Init(Loopback* aThis, RxRing* aRx, TxRing* aTx, struct napi_struct* aNapi)
+{
+    printk(KERN_DEBUG PREFIX "%s( , , ,  )\n", __FUNCTION__);
+
+    memset(aThis, 0, sizeof(*aThis));
+
+    aThis->mNapi = aNapi;
+    aThis->mRx   = aRx;
+    aThis->mTx   = aTx;
+
+    INIT_WORK(&aThis->mWork, Work);
+
+    spin_lock_init(&aThis->mLock);
+}
+
+void Loopback_IntEnable(Loopback* aThis)
+{
+    unsigned long lFlags;
+
+    spin_lock_irqsave(&aThis->mLock, lFlags);
+    aThis->mIntEnabled = true;
+    spin_unlock_irqrestore(&aThis->mLock, lFlags);
+
+    Interrupt_Raise(aThis);
+}
+
+void Loopback_Start(Loopback* aThis)
+{
+    printk(KERN_DEBUG PREFIX "%s(  )\n", __FUNCTION__);
+
+    aThis->mIntEnabled = false;
+    aThis->mIntPending = false;
+    aThis->mRxHead     = aThis->mRx->mHead;
+    aThis->mRxMissed   = 0;
+    aThis->mRxNext     = aThis->mRx->mTail;
+    aThis->mTxHead     = aThis->mTx->mHead;
+    aThis->mTxNext     = aThis->mTx->mHead;
+}
+
+void Loopback_Stop(Loopback* aThis)
+{
+    printk(KERN_DEBUG PREFIX "%s(  )\n", __FUNCTION__);
+
+    unsigned long lFlags;
+
+    spin_lock_irqsave(&aThis->mLock, lFlags);
+    aThis->mIntEnabled = false;
+    spin_unlock_irqrestore(&aThis->mLock, lFlags);
+
+    cancel_work_sync(&aThis->mWork);
+}
+
+// The work item reads the new head when it fills a buffer, no need to
+// queue it.
+void Loopback_RxKick(Loopback* aThis, unsigned int aHead)
+{
+    // The descriptors are written before the new head.
+    smp_store_release(&aThis->mRxHead, aHead);
+}
+
+void Loopback_TxKick(Loopback* aThis, unsigned int aHead)
+{
+    // The descriptors are written before the new head.
+    smp_store_release(&aThis->mTxHead, aHead);
+
+    queue_work(system_highpri_wq, &aThis->mWork);
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+// The interrupt fires when it is enabled and a completion is pending, then
+// it is disabled. The interrupt handler of a real device runs with the
+// bottom halves disabled, so the NAPI softirq runs when they are enabled
+// again.
+void Interrupt_Raise(Loopback* aThis)
+{
+    unsigned long lFlags;
+    bool          lFire;
+
+    spin_lock_irqsave(&aThis->mLock, lFlags);
+    lFire = aThis->mIntEnabled && aThis->mIntPending;
+    if (lFire)
+    {
+        aThis->mIntEnabled = false;
+        aThis->mIntPending = false;
+    }
+    spin_unlock_irqrestore(&aThis->mLock, lFlags);
+
+    if (lFire)
+    {
+        local_bh_disable();
+        napi_schedule(aThis->mNapi);
+        local_bh_enable();
+    }
+}
+
+// Called before the transmit descriptor is done, so the sk_buff is still
+// there.
+void Rx_Write(Loopback* aThis, const struct sk_buff* aSkb)
+{
+    if (aThis->mRxNext == smp_load_acquire(&aThis->mRxHead))
+    {
+        aThis->mRxMissed++;
+        return;
+    }
+
+    unsigned int lIndex = aThis->mRxNext % RX_RING_QTY;
+
+    RxDesc* lD = aThis->mRx->mDescs + lIndex;
+
+    if ((lD->mControl & RX_DESC_SIZE) < aSkb->len)
+    {
+        aThis->mRxMissed++;
+        return;
+    }
+
+    skb_copy_bits(aSkb, 0, aThis->mRx->mBuffers[lIndex].mSkb->data, aSkb->len);
+
+    // The frame is written before the status.
+    dma_wmb();
+
+    WRITE_ONCE(lD->mStatus, RX_DESC_DONE | aSkb->len);
+
+    aThis->mRxNext++;
+}
+
+// ===== Entry points =======================================================
+
+void Work(struct work_struct* aWork)
+{
+    Loopback* lThis = container_of(aWork, Loopback, mWork);
+
+    unsigned int lHead = smp_load_acquire(&lThis->mTxHead);
+
+    if (lThis->mTxNext == lHead)
+    {
+        return;
+    }
+
+    while (lThis->mTxNext != lHead)
+    {
+        unsigned int lIndex = lThis->mTxNext % TX_RING_QTY;
+
+        TxDesc* lD = lThis->mTx->mDescs + lIndex;
+
+        if (0 != (lD->mControl & TX_DESC_EOP))
+        {
+            Rx_Write(lThis, lThis->mTx->mBuffers[lIndex].mSkb);
+        }
+
+        // The engine writes the status after it read the descriptor.
+        dma_wmb();
+
+        WRITE_ONCE(lD->mStatus, TX_DESC_DONE);
+
+        lThis->mTxNext++;
+    }
+
+    unsigned long lFlags;
+
+    spin_lock_irqsave(&lThis->mLock, lFlags);
+    lThis->mIntPending = true;
+    spin_unlock_irqrestore(&lThis->mLock, lFlags);
+
+    Interrupt_Raise(lThis);
+}
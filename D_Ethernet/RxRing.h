@@ -0,0 +1,92 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMS-Sample
+// File      D_Ethernet/RxRing.h
+
+#pragma once
+
+// ===== Linux kernel =======================================================
+#include <linux/dma-mapping.h>
+#include <linux/if_vlan.h>
+#include <linux/netdevice.h>
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+// Must be a power of 2
+#define RX_RING_QTY (256)
+
+// A frame of the default MTU, with a VLAN tag
+#define RX_FRAME_MAX_byte (VLAN_ETH_FRAME_LEN)
+
+#define RX_DESC_SIZE (0x0000ffff) // mControl - Size of the buffer in byte
+                                  // mStatus  - Size of the frame in byte
+#define RX_DESC_DONE (0x80000000) // mStatus  - Written by the engine
+
+// Data types
+// //////////////////////////////////////////////////////////////////////////
+
+// One buffer, as the engine reads it
+typedef struct
+{
+    uint64_t mAddr; // Bus address
+    uint32_t mControl;
+    uint32_t mStatus;
+}
+RxDesc;
+
+// The driver side of a descriptor
+typedef struct
+{
+    struct sk_buff* mSkb;
+
+    dma_addr_t mAddr;
+}
+RxBuffer;
+
+// The indexes are free running, the slot is Index % RX_RING_QTY. The
+// descriptors from mTail to mHead have a buffer posted. Only the NAPI poll
+// writes them, after Open.
+typedef struct
+{
+    struct device    * mDmaDev; // NULL when there is no device to map for
+    struct net_device* mNetDev;
+
+    RxDesc   * mDescs;
+    dma_addr_t mDescs_DA;
+
+    RxBuffer mBuffers[RX_RING_QTY];
+
+    unsigned int mHead; // Next descriptor RxRing_Refill posts a buffer to
+    unsigned int mTail; // Next descriptor RxRing_Receive reads
+}
+RxRing;
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+// Allocate the descriptors and post a buffer to each of them
+//
+// aDmaDev  The device doing the DMA, NULL for the loopback engine
+//
+// Return
+//  0
+//  - ENOMEM
+extern int RxRing_Init(RxRing* aThis, struct net_device* aNetDev, struct device* aDmaDev);
+
+// The engine must be stopped
+extern void RxRing_Uninit(RxRing* aThis);
+
+// Pass the received frames to GRO, at most aBudget
+//
+// aBytes [---;-W-] The size of the received frames
+//
+// Return  The count of received frames
+extern unsigned int RxRing_Receive(RxRing* aThis, struct napi_struct* aNapi, unsigned int aBudget, unsigned int* aBytes);
+
+// Post a buffer to each empty descriptor. When an allocation fails, the
+// next call tries again and, meanwhile, the engine has fewer buffers.
+//
+// Return  The count of posted buffers
+extern unsigned int RxRing_Refill(RxRing* aThis, gfp_t aFlags);
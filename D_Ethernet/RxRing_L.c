@@ -0,0 +1,181 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMS-Sample
+// File      D_Ethernet/RxRing_L.c
+
+#include "Component.h"
+
+// ===== Linux kernel =======================================================
+#include <linux/etherdevice.h>
+
+// ===== Local ==============================================================
+#include "RxRing.h"
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static void Buffer_Unmap(RxRing* aThis, RxBuffer* aBuffer);
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+int RxRing_Init(RxRing* aThis, struct net_device* aNetDev, struct device* aDmaDev)
+{
+    printk(KERN_DEBUG PREFIX "%s( , ,  )\n", __FUNCTION__);
+
+    unsigned int lSize_byte = sizeof(RxDesc) * RX_RING_QTY;
+
+    memset(aThis, 0, sizeof(*aThis));
+
+    aThis->mDmaDev = aDmaDev;
+    aThis->mNetDev = aNetDev;
+
+    if (NULL != aDmaDev)
+    {
+        aThis->mDescs = dma_alloc_coherent(aDmaDev, lSize_byte, &aThis->mDescs_DA, GFP_KERNEL);
+    }
+    else
+    {
+        aThis->mDescs = kzalloc(lSize_byte, GFP_KERNEL);
+    }
+
+    if ((NULL == aThis->mDescs) || (RX_RING_QTY != RxRing_Refill(aThis, GFP_KERNEL)))
+    {
+        printk(KERN_ERR PREFIX "%s - ENOMEM\n", __FUNCTION__);
+
+        if (NULL != aThis->mDescs)
+        {
+            RxRing_Uninit(aThis);
+        }
+
+        return - ENOMEM;
+    }
+
+    return 0;
+}
+
+void RxRing_Uninit(RxRing* aThis)
+{
+    printk(KERN_DEBUG PREFIX "%s(  )\n", __FUNCTION__);
+
+    unsigned int lSize_byte = sizeof(RxDesc) * RX_RING_QTY;
+
+    while (aThis->mTail != aThis->mHead)
+    {
+        RxBuffer* lB = aThis->mBuffers + (aThis->mTail % RX_RING_QTY);
+
+        Buffer_Unmap(aThis, lB);
+
+        dev_kfree_skb_any(lB->mSkb);
+        lB->mSkb = NULL;
+
+        aThis->mTail++;
+    }
+
+    if (NULL != aThis->mDmaDev)
+    {
+        dma_free_coherent(aThis->mDmaDev, lSize_byte, aThis->mDescs, aThis->mDescs_DA);
+    }
+    else
+    {
+        kfree(aThis->mDescs);
+    }
+
+    aThis->mDescs = NULL;
+}
+
+unsigned int RxRing_Receive(RxRing* aThis, struct napi_struct* aNapi, unsigned int aBudget, unsigned int* aBytes)
+{
+    unsigned int lBytes  = 0;
+    unsigned int lResult = 0;
+
+    while ((aBudget > lResult) && (aThis->mTail != aThis->mHead))
+    {
+        unsigned int lIndex = aThis->mTail % RX_RING_QTY;
+
+        uint32_t lStatus = READ_ONCE(aThis->mDescs[lIndex].mStatus);
+        if (0 == (lStatus & RX_DESC_DONE))
+        {
+            break;
+        }
+
+        // Read the status before the frame
+        dma_rmb();
+
+        RxBuffer* lB = aThis->mBuffers + lIndex;
+
+        Buffer_Unmap(aThis, lB);
+
+        struct sk_buff* lSkb = lB->mSkb;
+
+        lB->mSkb = NULL;
+
+        skb_put(lSkb, lStatus & RX_DESC_SIZE);
+
+        lBytes += lSkb->len;
+
+        lSkb->protocol = eth_type_trans(lSkb, aThis->mNetDev);
+
+        napi_gro_receive(aNapi, lSkb);
+
+        aThis->mTail++;
+        lResult++;
+    }
+
+    *aBytes = lBytes;
+
+    return lResult;
+}
+
+unsigned int RxRing_Refill(RxRing* aThis, gfp_t aFlags)
+{
+    unsigned int lResult = 0;
+
+    while (RX_RING_QTY > (aThis->mHead - aThis->mTail))
+    {
+        unsigned int lIndex = aThis->mHead % RX_RING_QTY;
+
+        RxBuffer* lB = aThis->mBuffers + lIndex;
+        RxDesc  * lD = aThis->mDescs   + lIndex;
+
+        lB->mSkb = __netdev_alloc_skb_ip_align(aThis->mNetDev, RX_FRAME_MAX_byte, aFlags);
+        if (NULL == lB->mSkb)
+        {
+            break;
+        }
+
+        lB->mAddr = 0;
+
+        if (NULL != aThis->mDmaDev)
+        {
+            lB->mAddr = dma_map_single(aThis->mDmaDev, lB->mSkb->data, RX_FRAME_MAX_byte, DMA_FROM_DEVICE);
+            if (dma_mapping_error(aThis->mDmaDev, lB->mAddr))
+            {
+                dev_kfree_skb_any(lB->mSkb);
+                lB->mSkb = NULL;
+                break;
+            }
+        }
+
+        lD->mAddr    = lB->mAddr;
+        lD->mControl = RX_FRAME_MAX_byte;
+        lD->mStatus  = 0;
+
+        aThis->mHead++;
+        lResult++;
+    }
+
+    return lResult;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+void Buffer_Unmap(RxRing* aThis, RxBuffer* aBuffer)
+{
+    if (NULL != aThis->mDmaDev)
+    {
+        dma_unmap_single(aThis->mDmaDev, aBuffer->mAddr, RX_FRAME_MAX_byte, DMA_FROM_DEVICE);
+    }
+}
@@ -0,0 +1,75 @@
+#!/bin/sh
+
+# Author    KMS - Martin Dubois, P. Eng.
+# Copyright (C) 2026 KMS
+# License   http://www.apache.org/licenses/LICENSE-2.0
+# Product   DrvDMA-Sample
+# File      D_Ethernet/Tests/Test1.sh
+
+# Transmit throughput with pktgen. Load the driver with the loopback
+# interface first, no FPGA needed:
+#   sudo insmod D_Ethernet.ko loopback=1
+#
+# Usage  Test1.sh [Interface] [Size_byte] [Count]
+
+echo Executing  Test1.sh  ...
+
+IF=${1:-eth0}
+SIZE=${2:-60}
+COUNT=${3:-10000000}
+
+PG=/proc/net/pktgen
+
+# ===== Functions ===========================================================
+
+pg_set () {
+    echo "$2" | sudo tee $1 > /dev/null
+}
+
+# ===== Execution ===========================================================
+
+echo ----- 0. Setup ---------------------------------------------------------
+
+sudo modprobe pktgen
+
+if [ ! -e $PG/kpktgend_0 ] ; then
+    echo ERROR  pktgen is not available
+    exit 1
+fi
+
+sudo ip link set $IF up
+
+pg_set $PG/kpktgend_0 "rem_device_all"
+pg_set $PG/kpktgend_0 "add_device $IF"
+
+pg_set $PG/$IF "count $COUNT"
+pg_set $PG/$IF "pkt_size $SIZE"
+pg_set $PG/$IF "delay 0"
+pg_set $PG/$IF "dst 10.0.0.2"
+pg_set $PG/$IF "dst_mac ff:ff:ff:ff:ff:ff"
+pg_set $PG/$IF "burst 32"
+
+echo ----- 1. Transmit ------------------------------------------------------
+
+pg_set $PG/pgctrl "start"
+
+cat $PG/$IF
+read -p "INSTRUCTION Note the pps and the Mb/sec and press ENTER" RESPONSE
+
+echo ----- 2. Byte queue limits ---------------------------------------------
+
+BQL=/sys/class/net/$IF/queues/tx-0/byte_queue_limits
+
+cat $BQL/limit
+cat $BQL/inflight
+read -p "INSTRUCTION Verify the limit is not 0 and the inflight is 0 and press ENTER" RESPONSE
+
+echo ----- 3. ip ------------------------------------------------------------
+
+ip -s link show $IF
+read -p "INSTRUCTION Verify the TX packet count ($COUNT) and press ENTER" RESPONSE
+
+pg_set $PG/kpktgend_0 "rem_device_all"
+
+# ===== End =================================================================
+echo OK
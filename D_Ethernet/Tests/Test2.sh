@@ -0,0 +1,98 @@
+#!/bin/sh
+
+# Author    KMS - Martin Dubois, P. Eng.
+# Copyright (C) 2026 KMS
+# License   http://www.apache.org/licenses/LICENSE-2.0
+# Product   DrvDMA-Sample
+# File      D_Ethernet/Tests/Test2.sh
+
+# Receive throughput with the loopback engine. pktgen transmits, the engine
+# copies each frame into a receive buffer and the NAPI poll receives it.
+# Load the driver with the loopback interface first, no FPGA needed:
+#   sudo insmod D_Ethernet.ko loopback=1
+#
+# The softirq time of /proc/stat only contains the NAPI poll when the
+# kernel has CONFIG_IRQ_TIME_ACCOUNTING, otherwise it counts as system time.
+#
+# Usage  Test2.sh [Interface] [Size_byte] [Count]
+
+echo Executing  Test2.sh  ...
+
+IF=${1:-eth0}
+SIZE=${2:-60}
+COUNT=${3:-10000000}
+
+PG=/proc/net/pktgen
+STAT=/sys/class/net/$IF/statistics
+
+# ===== Functions ===========================================================
+
+pg_set () {
+    echo "$2" | sudo tee $1 > /dev/null
+}
+
+# Return  The softirq time of all the CPUs, in tick
+softirq_get () {
+    awk '/^cpu / { print $8 }' /proc/stat
+}
+
+# ===== Execution ===========================================================
+
+echo ----- 0. Setup ---------------------------------------------------------
+
+sudo modprobe pktgen
+
+if [ ! -e $PG/kpktgend_0 ] ; then
+    echo ERROR  pktgen is not available
+    exit 1
+fi
+
+sudo ip link set $IF up
+
+pg_set $PG/kpktgend_0 "rem_device_all"
+pg_set $PG/kpktgend_0 "add_device $IF"
+
+pg_set $PG/$IF "count $COUNT"
+pg_set $PG/$IF "pkt_size $SIZE"
+pg_set $PG/$IF "delay 0"
+pg_set $PG/$IF "dst 10.0.0.2"
+pg_set $PG/$IF "dst_mac ff:ff:ff:ff:ff:ff"
+pg_set $PG/$IF "burst 32"
+
+echo ----- 1. Receive -------------------------------------------------------
+
+HZ=$(getconf CLK_TCK)
+
+RX_0=$(cat $STAT/rx_packets)
+SI_0=$(softirq_get)
+T_0=$(date +%s.%N)
+
+pg_set $PG/pgctrl "start"
+
+T_1=$(date +%s.%N)
+SI_1=$(softirq_get)
+RX_1=$(cat $STAT/rx_packets)
+
+echo "$RX_0 $RX_1 $SI_0 $SI_1 $T_0 $T_1 $HZ" | awk '{
+    lRx  = $2 - $1
+    lSI  = ($4 - $3) / $7
+    lDur = $6 - $5
+    printf "Received          : %u frames in %.3f s\n", lRx, lDur
+    printf "Throughput        : %.3f Mpps\n", lRx / lDur / 1000000
+    if (0 < lRx) {
+        printf "Softirq CPU       : %.3f s, %.3f CPU s per million frames\n", lSI, lSI * 1000000 / lRx
+    }
+}'
+
+echo "Missed            : $(cat $STAT/rx_missed_errors) frames"
+read -p "INSTRUCTION Note the throughput, the softirq CPU and the missed frame count and press ENTER" RESPONSE
+
+echo ----- 2. ip ------------------------------------------------------------
+
+ip -s link show $IF
+read -p "INSTRUCTION Verify the RX packet count plus the missed count is the TX packet count and press ENTER" RESPONSE
+
+pg_set $PG/kpktgend_0 "rem_device_all"
+
+# ===== End =================================================================
+echo OK
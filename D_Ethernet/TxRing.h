@@ -0,0 +1,94 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMS-Sample
+// File      D_Ethernet/TxRing.h
+
+#pragma once
+
+// ===== Linux kernel =======================================================
+#include <linux/dma-mapping.h>
+#include <linux/skbuff.h>
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+// Must be a power of 2
+#define TX_RING_QTY (256)
+
+#define TX_DESC_EOP  (0x80000000) // mControl - Last descriptor of the frame
+#define TX_DESC_SIZE (0x0000ffff) // mControl - Size of the fragment in byte
+
+#define TX_DESC_DONE (0x00000001) // mStatus - Written by the engine
+
+// Data types
+// //////////////////////////////////////////////////////////////////////////
+
+// One fragment, as the engine reads it
+typedef struct
+{
+    uint64_t mAddr; // Bus address
+    uint32_t mControl;
+    uint32_t mStatus;
+}
+TxDesc;
+
+// The driver side of a descriptor
+typedef struct
+{
+    struct sk_buff* mSkb; // On the last descriptor of the frame only
+
+    dma_addr_t   mAddr;
+    unsigned int mSize_byte;
+    bool         mPage; // Mapped with skb_frag_dma_map
+}
+TxBuffer;
+
+// The indexes are free running, the slot is Index % TX_RING_QTY. Only
+// StartXmit writes mHead and only the NAPI poll writes mTail.
+typedef struct
+{
+    struct device* mDmaDev; // NULL when there is no device to map for
+
+    TxDesc   * mDescs;
+    dma_addr_t mDescs_DA;
+
+    TxBuffer mBuffers[TX_RING_QTY];
+
+    unsigned int mHead; // Next descriptor TxRing_Post fills
+    unsigned int mTail; // Next descriptor TxRing_Clean reclaims
+}
+TxRing;
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+// aDmaDev  The device doing the DMA, NULL for the loopback engine without
+//          device
+//
+// Return
+//  0
+//  - ENOMEM
+extern int TxRing_Init(TxRing* aThis, struct device* aDmaDev);
+
+// The engine must be stopped
+extern void TxRing_Uninit(TxRing* aThis);
+
+// Reclaim the descriptors the engine completed
+//
+// aBudget      The NAPI budget, 0 outside of the NAPI poll
+// aBytes [---;-W-] The size of the reclaimed frames
+//
+// Return  The count of reclaimed frames
+extern unsigned int TxRing_Clean(TxRing* aThis, int aBudget, unsigned int* aBytes);
+
+extern unsigned int TxRing_GetFree(const TxRing* aThis);
+
+// Map the fragments and fill one descriptor per fragment. The caller
+// verified the free descriptor count. The engine sees the descriptors only
+// after the doorbell.
+//
+// Return
+//  0
+//  - ENOMEM  Mapping failed, nothing posted
+extern int TxRing_Post(TxRing* aThis, struct sk_buff* aSkb);
@@ -0,0 +1,237 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMS-Sample
+// File      D_Ethernet/TxRing_L.c
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "TxRing.h"
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static int  Buffer_Map  (TxRing* aThis, TxBuffer* aBuffer, struct sk_buff* aSkb, unsigned int aFragment);
+static void Buffer_Unmap(TxRing* aThis, TxBuffer* aBuffer);
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+int TxRing_Init(TxRing* aThis, struct device* aDmaDev)
+{
+    printk(KERN_DEBUG PREFIX "%s( ,  )\n", __FUNCTION__);
+
+    unsigned int lSize_byte = sizeof(TxDesc) * TX_RING_QTY;
+
+    memset(aThis, 0, sizeof(*aThis));
+
+    aThis->mDmaDev = aDmaDev;
+
+    if (NULL != aDmaDev)
+    {
+        aThis->mDescs = dma_alloc_coherent(aDmaDev, lSize_byte, &aThis->mDescs_DA, GFP_KERNEL);
+    }
+    else
+    {
+        aThis->mDescs = kzalloc(lSize_byte, GFP_KERNEL);
+    }
+
+    if (NULL == aThis->mDescs)
+    {
+        printk(KERN_ERR PREFIX "%s - ENOMEM\n", __FUNCTION__);
+        return - ENOMEM;
+    }
+
+    return 0;
+}
+
+// The frames the engine did not complete are dropped.
+void TxRing_Uninit(TxRing* aThis)
+{
+    printk(KERN_DEBUG PREFIX "%s(  )\n", __FUNCTION__);
+
+    unsigned int lSize_byte = sizeof(TxDesc) * TX_RING_QTY;
+
+    while (aThis->mTail != aThis->mHead)
+    {
+        TxBuffer* lB = aThis->mBuffers + (aThis->mTail % TX_RING_QTY);
+
+        Buffer_Unmap(aThis, lB);
+
+        if (NULL != lB->mSkb)
+        {
+            dev_kfree_skb_any(lB->mSkb);
+            lB->mSkb = NULL;
+        }
+
+        aThis->mTail++;
+    }
+
+    if (NULL != aThis->mDmaDev)
+    {
+        dma_free_coherent(aThis->mDmaDev, lSize_byte, aThis->mDescs, aThis->mDescs_DA);
+    }
+    else
+    {
+        kfree(aThis->mDescs);
+    }
+
+    aThis->mDescs = NULL;
+}
+
+unsigned int TxRing_Clean(TxRing* aThis, int aBudget, unsigned int* aBytes)
+{
+    unsigned int lBytes  = 0;
+    unsigned int lHead   = smp_load_acquire(&aThis->mHead);
+    unsigned int lResult = 0;
+    unsigned int lTail   = aThis->mTail;
+
+    while (lTail != lHead)
+    {
+        unsigned int lIndex = lTail % TX_RING_QTY;
+
+        if (0 == (READ_ONCE(aThis->mDescs[lIndex].mStatus) & TX_DESC_DONE))
+        {
+            break;
+        }
+
+        // Read the status before anything the engine wrote before it
+        dma_rmb();
+
+        TxBuffer* lB = aThis->mBuffers + lIndex;
+
+        Buffer_Unmap(aThis, lB);
+
+        if (NULL != lB->mSkb)
+        {
+            lBytes += lB->mSkb->len;
+            lResult++;
+
+            napi_consume_skb(lB->mSkb, aBudget);
+            lB->mSkb = NULL;
+        }
+
+        lTail++;
+    }
+
+    // StartXmit reads mTail to count the free descriptors.
+    smp_store_release(&aThis->mTail, lTail);
+
+    *aBytes = lBytes;
+
+    return lResult;
+}
+
+unsigned int TxRing_GetFree(const TxRing* aThis)
+{
+    return TX_RING_QTY - (READ_ONCE(aThis->mHead) - READ_ONCE(aThis->mTail));
+}
+
+int TxRing_Post(TxRing* aThis, struct sk_buff* aSkb)
+{
+    unsigned int lQty = skb_shinfo(aSkb)->nr_frags + 1;
+    unsigned int i;
+
+    for (i = 0; i < lQty; i++)
+    {
+        TxBuffer* lB = aThis->mBuffers + ((aThis->mHead + i) % TX_RING_QTY);
+
+        if (0 != Buffer_Map(aThis, lB, aSkb, i))
+        {
+            while (0 < i)
+            {
+                i--;
+                Buffer_Unmap(aThis, aThis->mBuffers + ((aThis->mHead + i) % TX_RING_QTY));
+            }
+
+            return - ENOMEM;
+        }
+    }
+
+    for (i = 0; i < lQty; i++)
+    {
+        unsigned int lIndex = (aThis->mHead + i) % TX_RING_QTY;
+
+        TxBuffer* lB = aThis->mBuffers + lIndex;
+        TxDesc  * lD = aThis->mDescs   + lIndex;
+
+        lD->mAddr    = lB->mAddr;
+        lD->mControl = lB->mSize_byte;
+        lD->mStatus  = 0;
+    }
+
+    unsigned int lLast = (aThis->mHead + lQty - 1) % TX_RING_QTY;
+
+    aThis->mBuffers[lLast].mSkb      = aSkb;
+    aThis->mDescs  [lLast].mControl |= TX_DESC_EOP;
+
+    // The NAPI poll must see the cleared status before the new head.
+    smp_store_release(&aThis->mHead, aThis->mHead + lQty);
+
+    return 0;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+// aFragment  0 for the linear part, i + 1 for the fragment i
+int Buffer_Map(TxRing* aThis, TxBuffer* aBuffer, struct sk_buff* aSkb, unsigned int aFragment)
+{
+    const skb_frag_t* lFrag = NULL;
+
+    aBuffer->mAddr = 0;
+    aBuffer->mPage = (0 < aFragment);
+    aBuffer->mSkb  = NULL;
+
+    if (0 == aFragment)
+    {
+        aBuffer->mSize_byte = skb_headlen(aSkb);
+    }
+    else
+    {
+        lFrag = skb_shinfo(aSkb)->frags + (aFragment - 1);
+
+        aBuffer->mSize_byte = skb_frag_size(lFrag);
+    }
+
+    // A GSO frame may have an empty linear part.
+    if ((NULL == aThis->mDmaDev) || (0 == aBuffer->mSize_byte))
+    {
+        return 0;
+    }
+
+    if (NULL == lFrag)
+    {
+        aBuffer->mAddr = dma_map_single(aThis->mDmaDev, aSkb->data, aBuffer->mSize_byte, DMA_TO_DEVICE);
+    }
+    else
+    {
+        aBuffer->mAddr = skb_frag_dma_map(aThis->mDmaDev, lFrag, 0, aBuffer->mSize_byte, DMA_TO_DEVICE);
+    }
+
+    if (dma_mapping_error(aThis->mDmaDev, aBuffer->mAddr))
+    {
+        aBuffer->mSize_byte = 0;
+        return - ENOMEM;
+    }
+
+    return 0;
+}
+
+void Buffer_Unmap(TxRing* aThis, TxBuffer* aBuffer)
+{
+    if ((NULL != aThis->mDmaDev) && (0 < aBuffer->mSize_byte))
+    {
+        if (aBuffer->mPage)
+        {
+            dma_unmap_page(aThis->mDmaDev, aBuffer->mAddr, aBuffer->mSize_byte, DMA_TO_DEVICE);
+        }
+        else
+        {
+            dma_unmap_single(aThis->mDmaDev, aBuffer->mAddr, aBuffer->mSize_byte, DMA_TO_DEVICE);
+        }
+    }
+
+    aBuffer->mSize_byte = 0;
+}
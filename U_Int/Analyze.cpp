@@ -0,0 +1,207 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/Analyze.cpp
+
+#include "Component.h"
+
+// ===== C++ ================================================================
+#include <fstream>
+
+#ifdef _KMS_LINUX_
+    // ===== System =========================================================
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+// ===== Local ==============================================================
+#include "Capture.h"
+#include "CaptureFile.h"
+#include "Clock.h"
+#include "Report.h"
+
+#include "Analyze.h"
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static const uint8_t* Map  (const char* aFileName, uint64_t* aSize_byte);
+static void           Unmap(const uint8_t* aBase, uint64_t aSize_byte);
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+int Analyze(const Options& aOptions)
+{
+    assert(nullptr != aOptions.mInput);
+
+    uint64_t lSize_byte;
+
+    auto lBase = Map(aOptions.mInput, &lSize_byte);
+    if (nullptr == lBase)
+    {
+        std::cout << "ERROR  Cannot map " << aOptions.mInput << std::endl;
+        return __LINE__;
+    }
+
+    int lResult = __LINE__;
+
+    auto lHeader = reinterpret_cast<const CaptureFile_Header*>(lBase);
+
+    if ((sizeof(CaptureFile_Header) > lSize_byte)
+        || (CAPTURE_FILE_MAGIC != lHeader->mMagic)
+        || (CAPTURE_FILE_VERSION != lHeader->mVersion)
+        || (sizeof(Sample) != lHeader->mRecordSize_byte)
+        || (0 == lHeader->mFrequency)
+        || (VECTOR_QTY_MAX < lHeader->mVectorQty))
+    {
+        std::cout << "ERROR  " << aOptions.mInput << " is not a version " << CAPTURE_FILE_VERSION << " capture file" << std::endl;
+    }
+    else
+    {
+        auto lCount = (lSize_byte - sizeof(CaptureFile_Header)) / sizeof(Sample);
+
+        if (0 != (lSize_byte - sizeof(CaptureFile_Header)) % sizeof(Sample))
+        {
+            std::cout << "WARNING  The last sample is truncated" << std::endl;
+        }
+
+        std::cout << "Performance counter frequency : " << lHeader->mFrequency << " Hz" << std::endl;
+        std::cout << "Samples                       : " << lCount << std::endl;
+
+        // Files written before the multi vector support contain 0.
+        unsigned int lVectorQty = (0 == lHeader->mVectorQty) ? 1 : lHeader->mVectorQty;
+
+        std::ofstream lFile;
+
+        if (nullptr != aOptions.mOutput)
+        {
+            lFile.open(aOptions.mOutput);
+        }
+
+        if ((nullptr != aOptions.mOutput) && !lFile.is_open())
+        {
+            std::cout << "ERROR  Cannot open " << aOptions.mOutput << std::endl;
+        }
+        else
+        {
+            Capture lCapture(lFile, lFile.is_open() ? FORMAT_TEXT : FORMAT_NONE, lHeader->mFrequency, lVectorQty);
+
+            lCapture.SetWindow(aOptions.mWindow_s);
+
+            auto     lSamples = reinterpret_cast<const Sample*>(lHeader + 1);
+            uint64_t lSkipped = 0;
+
+            for (uint64_t i = 0; i < lCount; i++)
+            {
+                if (lVectorQty > lSamples[i].GetVector())
+                {
+                    lCapture.Write(lSamples[i]);
+                }
+                else
+                {
+                    lSkipped++;
+                }
+            }
+
+            if (0 < lSkipped)
+            {
+                std::cout << "WARNING  " << lSkipped << " samples with an invalid vector skipped" << std::endl;
+            }
+
+            Report_Display(aOptions, lCapture, Clock_ToMicroSeconds(lHeader->mOverhead, lHeader->mFrequency));
+
+            lResult = 0;
+        }
+    }
+
+    Unmap(lBase, lSize_byte);
+
+    return lResult;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+const uint8_t* Map(const char* aFileName, uint64_t* aSize_byte)
+{
+    assert(nullptr != aFileName);
+    assert(nullptr != aSize_byte);
+
+    const uint8_t* lResult = nullptr;
+
+    #ifdef _KMS_LINUX_
+        auto lFD = open(aFileName, O_RDONLY);
+        if (0 <= lFD)
+        {
+            struct stat lStat;
+
+            if ((0 == fstat(lFD, &lStat)) && (0 < lStat.st_size))
+            {
+                auto lBase = mmap(nullptr, lStat.st_size, PROT_READ, MAP_PRIVATE, lFD, 0);
+                if (MAP_FAILED != lBase)
+                {
+                    // The samples are read once, in order.
+                    madvise(lBase, lStat.st_size, MADV_SEQUENTIAL);
+
+                    *aSize_byte = lStat.st_size;
+                    lResult     = reinterpret_cast<const uint8_t*>(lBase);
+                }
+            }
+
+            // The mapping stays valid after the close.
+            close(lFD);
+        }
+    #endif
+
+    #ifdef _KMS_WINDOWS_
+        auto lFile = CreateFileA(aFileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (INVALID_HANDLE_VALUE != lFile)
+        {
+            LARGE_INTEGER lSize;
+
+            if (GetFileSizeEx(lFile, &lSize) && (0 < lSize.QuadPart))
+            {
+                auto lMapping = CreateFileMappingA(lFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if (nullptr != lMapping)
+                {
+                    auto lBase = MapViewOfFile(lMapping, FILE_MAP_READ, 0, 0, 0);
+                    if (nullptr != lBase)
+                    {
+                        *aSize_byte = lSize.QuadPart;
+                        lResult     = reinterpret_cast<const uint8_t*>(lBase);
+                    }
+
+                    // The view keeps the mapping alive.
+                    CloseHandle(lMapping);
+                }
+            }
+
+            CloseHandle(lFile);
+        }
+    #endif
+
+    return lResult;
+}
+
+void Unmap(const uint8_t* aBase, uint64_t aSize_byte)
+{
+    assert(nullptr != aBase);
+
+    #ifdef _KMS_LINUX_
+        auto lRet = munmap(const_cast<uint8_t*>(aBase), aSize_byte);
+        assert(0 == lRet);
+        (void)lRet;
+    #endif
+
+    #ifdef _KMS_WINDOWS_
+        (void)aSize_byte;
+
+        auto lRetB = UnmapViewOfFile(aBase);
+        assert(lRetB);
+        (void)lRetB;
+    #endif
+}
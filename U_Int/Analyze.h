@@ -0,0 +1,20 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/Analyze.h
+
+#pragma once
+
+// ===== Local ==============================================================
+#include "Options.h"
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+// Map the binary capture --input, rebuild the statistics and the
+// histograms and, with --output, convert the samples to text. The driver
+// is not used.
+//
+// Return  0 or an error line number
+extern int Analyze(const Options& aOptions);
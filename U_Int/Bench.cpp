@@ -0,0 +1,102 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/Bench.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "Clock.h"
+#include "Stats.h"
+
+#include "Bench.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+// The buffer is added PASS_QTY times, so the differences stay in memory
+// without taking 800 MB.
+#define BUFFER_QTY (1000000)
+#define PASS_QTY   (100)
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static void Display(const char* aName, const Stats& aStats, uint64_t aDuration);
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+int Bench_Stats()
+{
+    auto lFrequency = Clock_GetFrequency();
+
+    auto lTicks = new uint64_t[BUFFER_QTY];
+
+    // Latencies from 1 us to about 1 ms, mostly short, with a long tail.
+    uint64_t lRandom = 1;
+
+    for (unsigned int i = 0; i < BUFFER_QTY; i++)
+    {
+        lRandom = lRandom * 6364136223846793005ULL + 1442695040888963407ULL;
+
+        auto lValue_us = 1.0 + static_cast<double>(lRandom >> 40) / (1 << 24) * ((0 == (i % 100)) ? 1000.0 : 50.0);
+
+        lTicks[i] = static_cast<uint64_t>(lValue_us * lFrequency / 1000000.0);
+    }
+
+    std::cout << "Samples : " << (static_cast<uint64_t>(BUFFER_QTY) * PASS_QTY) << std::endl;
+
+    Stats lScalar;
+
+    auto lStart = Clock_GetNow();
+
+    for (unsigned int p = 0; p < PASS_QTY; p++)
+    {
+        for (unsigned int i = 0; i < BUFFER_QTY; i++)
+        {
+            lScalar.AddSample(Clock_ToMicroSeconds(lTicks[i], lFrequency));
+        }
+    }
+
+    auto lScalarDuration = Clock_GetNow() - lStart;
+
+    Stats lBlock;
+
+    lStart = Clock_GetNow();
+
+    for (unsigned int p = 0; p < PASS_QTY; p++)
+    {
+        lBlock.AddSamples(lTicks, BUFFER_QTY, lFrequency);
+    }
+
+    auto lBlockDuration = Clock_GetNow() - lStart;
+
+    delete[] lTicks;
+
+    Display("AddSample ", lScalar, lScalarDuration);
+    Display("AddSamples", lBlock , lBlockDuration );
+
+    std::cout << "Speed up : " << (static_cast<double>(lScalarDuration) / lBlockDuration) << std::endl;
+
+    if (lScalar.GetCount() != lBlock.GetCount())
+    {
+        std::cout << "ERROR  The sample counts are different" << std::endl;
+        return __LINE__;
+    }
+
+    return 0;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+void Display(const char* aName, const Stats& aStats, uint64_t aDuration)
+{
+    auto lDuration_ns = Clock_ToMicroSeconds(aDuration, Clock_GetFrequency()) * 1000.0;
+
+    std::cout << aName << " : " << (lDuration_ns / aStats.GetCount()) << " ns/sample\n";
+    std::cout << "    " << aStats << "\n";
+    std::cout << "    p50 = " << aStats.GetPercentile(50.0) << " us p99 = " << aStats.GetPercentile(99.0) << " us p99.9 = " << aStats.GetPercentile(99.9) << " us" << std::endl;
+}
@@ -0,0 +1,17 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/Bench.h
+
+#pragma once
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+// Add the same 10 ^ 8 time stamp differences to a Stats instance with
+// AddSample and to another with AddSamples, then display the time per
+// sample of each and their statistics. The driver is not used.
+//
+// Return  0 or an error line number
+extern int Bench_Stats();
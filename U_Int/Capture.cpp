@@ -0,0 +1,425 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/Capture.cpp
+
+#include "Component.h"
+
+// ===== C++ ================================================================
+#include <chrono>
+
+// ===== Local ==============================================================
+#include "CaptureFile.h"
+#include "Clock.h"
+#include "Thread.h"
+
+#include "Capture.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+// At 1 kHz, the writer thread may stop for 65 s before samples are dropped.
+#define RING_CAPACITY (64 * 1024)
+
+#define IDLE_ms (1)
+
+static constexpr auto TRIG_MAX_us = 20;
+
+// The window of SetWindow moves by 1 / WINDOW_INTERVAL_QTY of its length.
+#define WINDOW_INTERVAL_QTY (10)
+
+// Public
+// //////////////////////////////////////////////////////////////////////////
+
+Capture::Capture(std::ostream& aOut, Format aFormat, uint64_t aFrequency, unsigned int aVectorQty)
+    : mOut(aOut), mFormat(aFormat), mFrequency(aFrequency), mStop(false), mTrig(aVectorQty), mUser(aVectorQty)
+    , mDecay(nullptr), mWindow(nullptr), mLast(0), mPublish(0), mWindow_s(0), mDecayP99_us(0.0), mWindowP99_us(0.0), mVectorQty(aVectorQty)
+{
+    assert(0 < aFrequency);
+    assert(0 < aVectorQty);
+    assert(VECTOR_QTY_MAX >= aVectorQty);
+
+    mVectors = new Vector[aVectorQty];
+
+    if (FORMAT_BINARY == aFormat)
+    {
+        CaptureFile_Header lHeader;
+
+        memset(&lHeader, 0, sizeof(lHeader));
+
+        lHeader.mFrequency       = aFrequency;
+        lHeader.mMagic           = CAPTURE_FILE_MAGIC;
+        lHeader.mOverhead        = Clock_GetOverhead();
+        lHeader.mRecordSize_byte = sizeof(Sample);
+        lHeader.mVectorQty       = aVectorQty;
+        lHeader.mVersion         = CAPTURE_FILE_VERSION;
+
+        mOut.write(reinterpret_cast<const char*>(&lHeader), sizeof(lHeader));
+    }
+}
+
+Capture::~Capture()
+{
+    assert(!mThread.joinable());
+    assert(nullptr != mVectors);
+
+    delete[] mVectors;
+
+    if (nullptr != mDecay ) { delete mDecay ; }
+    if (nullptr != mWindow) { delete mWindow; }
+}
+
+uint64_t Capture::GetCoalesced(unsigned int aVector) const
+{
+    assert(mVectorQty > aVector);
+
+    return mVectors[aVector].mCoalesced;
+}
+
+uint64_t Capture::GetDropped() const
+{
+    uint64_t lResult = 0;
+
+    for (unsigned int v = 0; v < mVectorQty; v++)
+    {
+        lResult += mVectors[v].mInterrupts.GetDropped() + mVectors[v].mTriggers.GetDropped();
+    }
+
+    return lResult;
+}
+
+uint64_t Capture::GetExtra(unsigned int aVector) const
+{
+    assert(mVectorQty > aVector);
+
+    return mVectors[aVector].mExtra;
+}
+
+Stats Capture::GetTrig() const
+{
+    Stats lResult;
+
+    mTrig.Get(&lResult);
+
+    return lResult;
+}
+
+Stats Capture::GetTrig(unsigned int aVector) const
+{
+    assert(mVectorQty > aVector);
+
+    Stats lResult;
+
+    mTrig.Get(aVector, &lResult);
+
+    return lResult;
+}
+
+Stats Capture::GetUser() const
+{
+    Stats lResult;
+
+    mUser.Get(&lResult);
+
+    return lResult;
+}
+
+Stats Capture::GetUser(unsigned int aVector) const
+{
+    assert(mVectorQty > aVector);
+
+    Stats lResult;
+
+    mUser.Get(aVector, &lResult);
+
+    return lResult;
+}
+
+void Capture::GetUserP99(double* aWindow_us, double* aDecay_us) const
+{
+    assert(nullptr != aWindow_us);
+    assert(nullptr != aDecay_us);
+
+    *aWindow_us = mWindowP99_us;
+    *aDecay_us  = mDecayP99_us;
+}
+
+const StatsDecay* Capture::GetUserDecay() const
+{
+    assert(!mThread.joinable());
+    assert(nullptr != mDecay);
+
+    return mDecay;
+}
+
+Stats Capture::GetUserWindow() const
+{
+    assert(!mThread.joinable());
+    assert(nullptr != mWindow);
+
+    Stats lResult;
+
+    mWindow->Get(mLast, &lResult);
+
+    return lResult;
+}
+
+unsigned int Capture::GetVectorQty() const { return mVectorQty; }
+
+unsigned int Capture::GetWindow_s() const { return mWindow_s; }
+
+bool Capture::OnInterrupt(const Sample& aSample)
+{
+    assert(mVectorQty > aSample.GetVector());
+
+    auto lV = mVectors + aSample.GetVector();
+
+    if (lV->mIntBusy.exchange(true, std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    lV->mInterrupts.Push(aSample);
+
+    lV->mIntBusy.store(false, std::memory_order_release);
+
+    return true;
+}
+
+void Capture::OnTrigger(const Sample& aSample)
+{
+    assert(mVectorQty > aSample.GetVector());
+
+    mVectors[aSample.GetVector()].mTriggers.Push(aSample);
+}
+
+void Capture::Reset()
+{
+    assert(!mThread.joinable());
+
+    for (unsigned int v = 0; v < mVectorQty; v++)
+    {
+        auto lV = mVectors + v;
+
+        lV->mCoalesced = 0;
+        lV->mExtra     = 0;
+    }
+
+    mTrig.Reset();
+    mUser.Reset();
+
+    if (nullptr != mWindow)
+    {
+        mDecay ->Reset();
+        mWindow->Reset();
+    }
+
+    mDecayP99_us  = 0.0;
+    mLast         = 0;
+    mPublish      = 0;
+    mWindowP99_us = 0.0;
+}
+
+void Capture::SetWindow(unsigned int aWindow_s)
+{
+    assert(!mThread.joinable());
+    assert(nullptr == mWindow);
+
+    if (0 < aWindow_s)
+    {
+        mDecay    = new StatsDecay(mFrequency * aWindow_s);
+        mWindow   = new StatsWindow(WINDOW_INTERVAL_QTY, mFrequency * aWindow_s / WINDOW_INTERVAL_QTY);
+        mWindow_s = aWindow_s;
+    }
+}
+
+void Capture::Start()
+{
+    assert(!mThread.joinable());
+
+    mStop = false;
+
+    mThread = std::thread(&Capture::Run, this);
+}
+
+void Capture::Stop()
+{
+    assert(mThread.joinable());
+
+    mStop = true;
+
+    mThread.join();
+}
+
+void Capture::Write(const Sample& aSample)
+{
+    assert(mVectorQty > aSample.GetVector());
+
+    switch (mFormat)
+    {
+    case FORMAT_BINARY: mOut.write(reinterpret_cast<const char*>(&aSample), sizeof(aSample)); break;
+    case FORMAT_NONE  : break;
+    case FORMAT_TEXT  : mOut << aSample; break;
+
+    default: assert(false);
+    }
+
+    auto lText = (FORMAT_TEXT == mFormat);
+
+    if (aSample.IsValid())
+    {
+        auto lTrig_us = aSample.GetTrig(mFrequency);
+        auto lUser_us = aSample.GetUser(mFrequency);
+
+        if (lText) { mOut << ";" << lTrig_us << ";" << lUser_us; }
+
+        mTrig.AddSample(aSample.GetVector(), lTrig_us);
+
+        if (TRIG_MAX_us >= lTrig_us)
+        {
+            mUser.AddSample(aSample.GetVector(), lUser_us);
+
+            if (nullptr != mWindow)
+            {
+                AddToWindow(aSample.GetTime(), lUser_us);
+            }
+
+            if (lText) { mOut << ";Used\n"; }
+        }
+        else
+        {
+            if (lText) { mOut << ";Ignored\n"; }
+        }
+    }
+    else
+    {
+        if (lText) { mOut << ";;;Invalid\n"; }
+    }
+}
+
+// Private
+// //////////////////////////////////////////////////////////////////////////
+
+Capture::Vector::Vector()
+    : mInterrupts(RING_CAPACITY), mTriggers(RING_CAPACITY), mIntBusy(false), mCoalesced(0), mExtra(0), mIntValid(false), mTrgValid(false)
+{}
+
+// The vectors are paired one after the other, so the sample times are only
+// almost in order.
+void Capture::AddToWindow(uint64_t aNow, double aUser_us)
+{
+    if (mLast < aNow)
+    {
+        mLast = aNow;
+    }
+
+    mDecay ->AddSample(aNow, aUser_us);
+    mWindow->AddSample(aNow, aUser_us);
+
+    if (mPublish <= aNow)
+    {
+        mPublish = aNow + mFrequency * mWindow_s / WINDOW_INTERVAL_QTY;
+
+        Stats lStats;
+
+        mWindow->Get(aNow, &lStats);
+
+        mDecayP99_us  = mDecay->GetPercentile(99.0);
+        mWindowP99_us = lStats .GetPercentile(99.0);
+    }
+}
+
+Capture::PairResult Capture::Pair(Vector* aV, bool aStop)
+{
+    assert(nullptr != aV);
+
+    if (!aV->mIntValid) { aV->mIntValid = aV->mInterrupts.Pop(&aV->mInt); }
+    if (!aV->mTrgValid) { aV->mTrgValid = aV->mTriggers  .Pop(&aV->mTrg); }
+
+    if (aV->mIntValid && (SAMPLE_ITERATION_NONE == aV->mInt.GetIteration()))
+    {
+        Write(aV->mInt);
+        aV->mIntValid = false;
+        aV->mExtra++;
+    }
+    else if (aV->mIntValid && aV->mTrgValid)
+    {
+        if (aV->mTrg.GetIteration() < aV->mInt.GetIteration())
+        {
+            // No interrupt for this trigger, or interrupts coalesced
+            Write(aV->mTrg);
+            aV->mTrgValid = false;
+            aV->mCoalesced++;
+        }
+        else if (aV->mTrg.GetIteration() == aV->mInt.GetIteration())
+        {
+            aV->mTrg.Merge(aV->mInt);
+            Write(aV->mTrg);
+            aV->mIntValid = false;
+            aV->mTrgValid = false;
+        }
+        else
+        {
+            // More than one interrupt for the same trigger
+            Write(aV->mInt);
+            aV->mIntValid = false;
+            aV->mExtra++;
+        }
+    }
+    else if (aStop)
+    {
+        // All the halves are pushed, the one left has no pair.
+        if      (aV->mTrgValid) { Write(aV->mTrg); aV->mTrgValid = false; }
+        else if (aV->mIntValid) { Write(aV->mInt); aV->mIntValid = false; aV->mExtra++; }
+        else
+        {
+            return PAIR_DONE;
+        }
+    }
+    else
+    {
+        return PAIR_IDLE;
+    }
+
+    return PAIR_WORK;
+}
+
+void Capture::Run()
+{
+    // Do not inherit the SCHED_FIFO class of a --trigger-fifo thread.
+    Thread_SetPriority(0);
+
+    for (;;)
+    {
+        // Read mStop before the rings, so the last pushes are seen.
+        bool lStop = mStop;
+
+        unsigned int lDone = 0;
+        bool         lWork = false;
+
+        for (unsigned int v = 0; v < mVectorQty; v++)
+        {
+            switch (Pair(mVectors + v, lStop))
+            {
+            case PAIR_DONE: lDone++; break;
+            case PAIR_IDLE: break;
+            case PAIR_WORK: lWork = true; break;
+
+            default: assert(false);
+            }
+        }
+
+        if (mVectorQty <= lDone)
+        {
+            break;
+        }
+
+        if (!lWork)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(IDLE_ms));
+        }
+    }
+
+    mOut.flush();
+}
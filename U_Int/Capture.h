@@ -0,0 +1,177 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/Capture.h
+
+#pragma once
+
+// ===== C++ ================================================================
+#include <thread>
+
+// ===== Local ==============================================================
+#include "Options.h"
+#include "Ring.h"
+#include "StatsDecay.h"
+#include "StatsShards.h"
+#include "StatsWindow.h"
+
+// The trigger thread and the interrupt callback each push their half of
+// the samples in the rings of the vector. A writer thread pairs the halves
+// using the iteration, writes the samples and updates the statistics of
+// the vector, so the capture length is not limited by memory. The analyzer
+// calls Write directly, without writer thread.
+class Capture
+{
+
+public:
+
+    // aOut        The stream receiving the samples. With FORMAT_BINARY, it
+    //             must be open in binary mode and the constructor writes
+    //             the CaptureFile_Header.
+    // aFormat     See Format
+    // aFrequency  The frequency of the counter used for the time stamps
+    // aVectorQty  1 to VECTOR_QTY_MAX
+    Capture(std::ostream& aOut, Format aFormat, uint64_t aFrequency, unsigned int aVectorQty);
+
+    // The writer thread must be stopped
+    ~Capture();
+
+    // Return  The count of triggers without their own interrupt, followed
+    //         by an interrupt for a later trigger
+    uint64_t GetCoalesced(unsigned int aVector) const;
+
+    // Return  The count of samples dropped because a ring was full
+    uint64_t GetDropped() const;
+
+    // Return  The count of interrupts without a trigger, received before the
+    //         first trigger or after the one of their trigger
+    uint64_t GetExtra(unsigned int aVector) const;
+
+    // The statistics of all the vectors or of one vector. The writer thread
+    // keeps running, so they can be read during a run.
+    Stats GetTrig() const;
+    Stats GetTrig(unsigned int aVector) const;
+    Stats GetUser() const;
+    Stats GetUser(unsigned int aVector) const;
+
+    // The p99 of the user time over the window and decaying, see
+    // SetWindow. The writer thread publishes them once per interval of the
+    // window, so they can be read during a run.
+    void GetUserP99(double* aWindow_us, double* aDecay_us) const;
+
+    // The user time statistics of all the vectors over the window and
+    // decaying, see SetWindow. The writer thread must be stopped.
+    const StatsDecay* GetUserDecay() const;
+    Stats             GetUserWindow() const;
+
+    unsigned int GetVectorQty() const;
+
+    // Return  0 without SetWindow
+    unsigned int GetWindow_s() const;
+
+    // Called from the interrupt callback. The rings of a vector have one
+    // producer, so a callback overlapping another one pushing for the same
+    // vector drops its sample, and its trigger stays without interrupt.
+    //
+    // Return  false if the sample was dropped
+    bool OnInterrupt(const Sample& aSample);
+
+    // Called from the trigger thread
+    void OnTrigger(const Sample& aSample);
+
+    // Clear the counters and the statistics. The writer thread must be
+    // stopped.
+    void Reset();
+
+    // Also keep the user time statistics of all the vectors over the last
+    // aWindow_s seconds, using the time stamps of the samples, and decaying
+    // ones with a time constant of aWindow_s. Call it once, before Start or
+    // the first Write.
+    //
+    // aWindow_s  0 means no window
+    void SetWindow(unsigned int aWindow_s);
+
+    void Start();
+
+    // Drain the rings, write the unpaired halves and stop the writer thread
+    void Stop();
+
+    // Write a sample and add it to the statistics of its vector
+    void Write(const Sample& aSample);
+
+private:
+
+    class Vector
+    {
+
+    public:
+
+        Vector();
+
+        Ring mInterrupts;
+        Ring mTriggers;
+
+        // Set while a callback pushes to mInterrupts
+        std::atomic<bool> mIntBusy;
+
+        // Only the writer thread writes them, the others read them after
+        // Stop.
+        uint64_t mCoalesced;
+        uint64_t mExtra;
+
+        // The halves the writer thread is pairing
+        Sample mInt;
+        bool   mIntValid;
+        Sample mTrg;
+        bool   mTrgValid;
+
+    };
+
+    typedef enum
+    {
+        PAIR_DONE, // Stopping and nothing left
+        PAIR_IDLE, // Waiting for a half
+        PAIR_WORK, // Wrote a sample
+    }
+    PairResult;
+
+    Capture(const Capture&);
+
+    const Capture& operator = (const Capture&);
+
+    // aNow      The time of the sample, in ticks
+    // aUser_us  The user time of the sample
+    void AddToWindow(uint64_t aNow, double aUser_us);
+
+    PairResult Pair(Vector* aVector, bool aStop);
+
+    void Run();
+
+    std::ostream& mOut;
+
+    Format   mFormat;
+    uint64_t mFrequency;
+
+    std::atomic<bool> mStop;
+
+    std::thread mThread;
+
+    // One shard per vector
+    StatsShards mTrig;
+    StatsShards mUser;
+
+    // Only the writer thread writes them, see SetWindow
+    StatsDecay * mDecay;
+    StatsWindow* mWindow;
+    uint64_t     mLast;    // The latest sample time
+    uint64_t     mPublish; // The time of the next publication
+    unsigned int mWindow_s;
+
+    std::atomic<double> mDecayP99_us;
+    std::atomic<double> mWindowP99_us;
+
+    unsigned int mVectorQty;
+    Vector     * mVectors;
+
+};
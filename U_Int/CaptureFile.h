@@ -0,0 +1,47 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/CaptureFile.h
+
+// A binary capture file is a CaptureFile_Header followed by the samples as
+// they are in memory, 40 bytes each, in the byte order of the computer
+// which made the capture.
+//
+// Offset  Size  Field
+//      0     8  Before trigger time stamp, in counter ticks
+//      8     8  After trigger time stamp
+//     16     8  On interrupt time stamp
+//     24     8  Interrupts, 0 when no interrupt matched the trigger
+//     32     4  Iteration
+//     36     4  Vector, index of the interrupt bit
+
+#pragma once
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+#define CAPTURE_FILE_MAGIC   (0x544e4955) // "UINT"
+#define CAPTURE_FILE_VERSION (1)
+
+// Data types
+// //////////////////////////////////////////////////////////////////////////
+
+typedef struct
+{
+    uint32_t mMagic;
+    uint16_t mVersion;
+    uint16_t mRecordSize_byte;
+
+    // The frequency of the counter used for the time stamps, in Hz
+    uint64_t mFrequency;
+
+    // The cost of a time stamp, in counter ticks, 0 if unknown
+    uint64_t mOverhead;
+
+    // The number of interrupt vectors, 0 means 1
+    uint32_t mVectorQty;
+
+    uint8_t mReserved0[4];
+}
+CaptureFile_Header;
@@ -0,0 +1,265 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/Clock.cpp
+
+#include "Component.h"
+
+// ===== C++ ================================================================
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define CLOCK_TSC
+
+    #ifdef _KMS_LINUX_
+        // ===== C ==========================================================
+        #include <cpuid.h>
+        #include <x86intrin.h>
+    #endif
+
+    #ifdef _KMS_WINDOWS_
+        // ===== C ==========================================================
+        #include <intrin.h>
+    #endif
+#endif
+
+#ifdef _KMS_LINUX_
+    // ===== System =========================================================
+    #include <time.h>
+#endif
+
+// ===== Local ==============================================================
+#include "Clock.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+#define CALIBRATION_ns (200000000)
+
+#define OVERHEAD_QTY (1001)
+
+// Variables
+// //////////////////////////////////////////////////////////////////////////
+
+static uint64_t    sFrequency = 0;
+static uint64_t    sOverhead  = 0;
+static ClockSource sSource    = CLOCK_SOURCE_OS;
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static uint64_t OS_GetFrequency();
+static uint64_t OS_GetNow();
+
+#ifdef CLOCK_TSC
+    static bool     TSC_Calibrate();
+    static uint64_t TSC_GetNow();
+    static bool     TSC_IsSupported();
+#endif
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+uint64_t Clock_GetFrequency()
+{
+    assert(0 < sFrequency);
+
+    return sFrequency;
+}
+
+uint64_t Clock_GetNow()
+{
+    #ifdef CLOCK_TSC
+        if (CLOCK_SOURCE_TSC == sSource)
+        {
+            return TSC_GetNow();
+        }
+    #endif
+
+    return OS_GetNow();
+}
+
+uint64_t Clock_GetOverhead() { return sOverhead; }
+
+bool Clock_Init(ClockSource aSource)
+{
+    sSource = aSource;
+
+    switch (aSource)
+    {
+    case CLOCK_SOURCE_OS: sFrequency = OS_GetFrequency(); break;
+
+    case CLOCK_SOURCE_TSC:
+        #ifdef CLOCK_TSC
+            if (TSC_IsSupported() && TSC_Calibrate())
+            {
+                break;
+            }
+        #endif
+        return false;
+
+    default: assert(false);
+    }
+
+    // Back to back calls, the median hides the interrupts and the
+    // preemptions.
+    uint64_t lDeltas[OVERHEAD_QTY];
+
+    for (unsigned int i = 0; i < OVERHEAD_QTY; i++)
+    {
+        auto lBegin = Clock_GetNow();
+
+        lDeltas[i] = Clock_GetNow() - lBegin;
+    }
+
+    std::nth_element(lDeltas, lDeltas + OVERHEAD_QTY / 2, lDeltas + OVERHEAD_QTY);
+
+    sOverhead = lDeltas[OVERHEAD_QTY / 2];
+
+    return true;
+}
+
+double Clock_ToMicroSeconds(uint64_t aTicks, uint64_t aFrequency)
+{
+    assert(0 < aFrequency);
+
+    double lResult_us = static_cast<double>(aTicks);
+
+    lResult_us /= aFrequency;
+    lResult_us *= 1000000;
+
+    return lResult_us;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+uint64_t OS_GetFrequency()
+{
+    #ifdef _KMS_LINUX_
+        return 1000000000;
+    #endif
+
+    #ifdef _KMS_WINDOWS_
+        uint64_t lResult;
+
+        auto lRetB = QueryPerformanceFrequency(reinterpret_cast<LARGE_INTEGER*>(&lResult));
+        assert(lRetB);
+        (void)lRetB;
+
+        return lResult;
+    #endif
+}
+
+uint64_t OS_GetNow()
+{
+    #ifdef _KMS_LINUX_
+        // CLOCK_MONOTONIC is read in the vDSO, without system call. When the
+        // kernel clock source is the invariant TSC, this costs a rdtsc and a
+        // few multiplications.
+        struct timespec lTS;
+
+        auto lRet = clock_gettime(CLOCK_MONOTONIC, &lTS);
+        assert(0 == lRet);
+        (void)lRet;
+
+        return static_cast<uint64_t>(lTS.tv_sec) * 1000000000 + lTS.tv_nsec;
+    #endif
+
+    #ifdef _KMS_WINDOWS_
+        uint64_t lResult;
+
+        auto lRetB = QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&lResult));
+        assert(lRetB);
+        (void)lRetB;
+
+        return lResult;
+    #endif
+}
+
+#ifdef CLOCK_TSC
+
+    // Count the TSC ticks during CALIBRATION_ns of OS clock. Each OS clock
+    // read is bracketed by two TSC reads and the middle is used, so the
+    // error is the OS clock read time divided by the calibration time.
+    bool TSC_Calibrate()
+    {
+        auto lOS_Frequency = OS_GetFrequency();
+        auto lOS_Duration  = static_cast<uint64_t>(static_cast<double>(CALIBRATION_ns) * lOS_Frequency / 1000000000.0);
+
+        auto lTSC0 = TSC_GetNow();
+        auto lOS0  = OS_GetNow();
+        auto lTSC1 = TSC_GetNow();
+
+        uint64_t lOS;
+        uint64_t lTSC2;
+        uint64_t lTSC3;
+
+        do
+        {
+            lTSC2 = TSC_GetNow();
+            lOS   = OS_GetNow();
+            lTSC3 = TSC_GetNow();
+        }
+        while (lOS0 + lOS_Duration > lOS);
+
+        double lTSC_Ticks = static_cast<double>((lTSC2 + lTSC3) / 2 - (lTSC0 + lTSC1) / 2);
+        double lOS_Ticks  = static_cast<double>(lOS - lOS0);
+
+        sFrequency = static_cast<uint64_t>(lTSC_Ticks * lOS_Frequency / lOS_Ticks);
+
+        return 0 < sFrequency;
+    }
+
+    // rdtscp waits for the previous instructions to execute and the lfence
+    // keeps the next ones from starting before the read, so the time stamp
+    // stays between the code it brackets.
+    uint64_t TSC_GetNow()
+    {
+        unsigned int lAux;
+
+        auto lResult = __rdtscp(&lAux);
+
+        _mm_lfence();
+
+        return lResult;
+    }
+
+    bool TSC_IsSupported()
+    {
+        unsigned int lInfo[4];
+
+        #ifdef _KMS_LINUX_
+            if (!__get_cpuid(0x80000001, lInfo + 0, lInfo + 1, lInfo + 2, lInfo + 3))
+            {
+                return false;
+            }
+        #endif
+
+        #ifdef _KMS_WINDOWS_
+            __cpuid(reinterpret_cast<int*>(lInfo), 0x80000001);
+        #endif
+
+        // EDX bit 27 - RDTSCP
+        if (0 == (lInfo[3] & (1 << 27)))
+        {
+            return false;
+        }
+
+        #ifdef _KMS_LINUX_
+            if (!__get_cpuid(0x80000007, lInfo + 0, lInfo + 1, lInfo + 2, lInfo + 3))
+            {
+                return false;
+            }
+        #endif
+
+        #ifdef _KMS_WINDOWS_
+            __cpuid(reinterpret_cast<int*>(lInfo), 0x80000007);
+        #endif
+
+        // EDX bit 8 - Invariant TSC, same rate in all P, C and T states
+        return 0 != (lInfo[3] & (1 << 8));
+    }
+
+#endif
@@ -0,0 +1,37 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/Clock.h
+
+#pragma once
+
+// ===== Local ==============================================================
+#include "Options.h"
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+// Return  The frequency of the counter Clock_GetNow reads, in Hz
+extern uint64_t Clock_GetFrequency();
+
+// Return  A monotonic time stamp, in counter ticks. Only differences between
+//         two time stamps are meaningful.
+extern uint64_t Clock_GetNow();
+
+// Return  The median cost of a Clock_GetNow call, in counter ticks, measured
+//         by Clock_Init. The trigger time contains it once.
+extern uint64_t Clock_GetOverhead();
+
+// Select the counter, calibrate the TSC against the OS clock and measure
+// the overhead. Call it before any other Clock_ function.
+//
+// Return  false if the TSC is not invariant or rdtscp is not supported
+extern bool Clock_Init(ClockSource aSource);
+
+// aTicks      A difference between two time stamps
+// aFrequency  The frequency of the counter, Clock_GetFrequency or the one
+//             saved with a capture
+//
+// Return  The difference in us
+extern double Clock_ToMicroSeconds(uint64_t aTicks, uint64_t aFrequency);
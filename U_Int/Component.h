@@ -1,4 +1,3 @@
-
 // Author    KMS - Martin Dubois, P. Eng.
 // Copyright (C) 2026 KMS
 // License   http://www.apache.org/licenses/LICENSE-2.0
@@ -9,12 +8,16 @@
 
 // ===== C ==================================================================
 #include <assert.h>
+#include <math.h>
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 
 // ===== C++ ================================================================
+#include <atomic>
 #include <iostream>
 
-// ===== Windows ============================================================
-#include <Windows.h>
-
-extern uint64_t gFrequency;
+#ifdef _KMS_WINDOWS_
+    // ===== Windows ========================================================
+    #include <Windows.h>
+#endif
@@ -0,0 +1,245 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/Delivery.cpp
+
+// Intel 82576EB Gigabit Ethernet Controller Datasheet
+// https://www.intel.com/content/dam/www/public/us/en/documents/datasheets/82576eg-gbe-datasheet.pdf
+
+#include "Component.h"
+
+// ===== C++ ================================================================
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// ===== Local ==============================================================
+#include "Thread.h"
+#include "Trigger.h"
+
+#include "Delivery.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+#define GPIE_NSICR (0x00000001) // Non Selective Interrupt Clear on Read
+
+// Intel 82576 registers
+#define REG_ICR  (0x1500 / sizeof(uint32_t)) // Interrupt Cause Read
+#define REG_IMS  (0x1508 / sizeof(uint32_t)) // Interrupt Mask Set
+#define REG_IMC  (0x150c / sizeof(uint32_t)) // Interrupt Mask Clear
+#define REG_GPIE (0x1514 / sizeof(uint32_t)) // General Purpose Interrupt Enable
+
+static const char* NAMES[DELIVERY_QTY] = { "blocked", "callback", "poll" };
+
+// Variables
+// //////////////////////////////////////////////////////////////////////////
+
+static Capture           * sCapture;
+static DrvDMA            * sDD;
+static Delivery            sDelivery;
+static uint32_t            sGPIE;
+static uint64_t            sMask;
+static volatile uint32_t * sReg;
+static std::atomic<bool>   sStop;
+static std::thread         sThread;
+
+// ===== Blocked ============================================================
+
+static std::condition_variable sCondition;
+static std::mutex              sMutex;
+static uint64_t                sPending;
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+// ===== Entry point ========================================================
+
+static void Blocked_OnInterrupt(void* aContext, uint64_t aInterrupts);
+
+static void Blocked_Run();
+static void Poll_Run   ();
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+const char* Delivery_GetName(Delivery aDelivery)
+{
+    assert(DELIVERY_QTY > aDelivery);
+
+    return NAMES[aDelivery];
+}
+
+bool Delivery_Start(Delivery aDelivery, DrvDMA* aDD, volatile uint32_t* aReg, const Options& aOptions, Capture* aCapture)
+{
+    assert(DELIVERY_QTY > aDelivery);
+    assert(nullptr != aDD);
+    assert(nullptr != aCapture);
+
+    sCapture  = aCapture;
+    sDD       = aDD;
+    sDelivery = aDelivery;
+    sMask     = Trigger_GetRegisterMask(aOptions);
+    sReg      = aReg;
+    sStop     = false;
+
+    auto lRet = DrvDMA_OK;
+
+    switch (aDelivery)
+    {
+    case DELIVERY_BLOCKED:
+        sPending = 0;
+
+        sThread = std::thread(Blocked_Run);
+
+        // A single registration receives all the vectors, so the callbacks
+        // of the different vectors are serialized or not as the DrvDMA
+        // stack does it.
+        lRet = aDD->Interrupt_Register(sMask, 0, Blocked_OnInterrupt, nullptr);
+        break;
+
+    case DELIVERY_CALLBACK:
+        lRet = aDD->Interrupt_Register(sMask, 0, Trigger_OnInterrupt, aCapture);
+        break;
+
+    case DELIVERY_POLL:
+        assert(nullptr != aReg);
+
+        // Without NSICR, reading ICR only clears the causes when the
+        // interrupt is asserted, and it is masked here.
+        aReg[REG_IMC] = static_cast<uint32_t>(sMask);
+
+        sGPIE = aReg[REG_GPIE];
+        aReg[REG_GPIE] = sGPIE | GPIE_NSICR;
+
+        Trigger_SetPolling(true);
+
+        sThread = std::thread(Poll_Run);
+        return true;
+
+    default: assert(false);
+    }
+
+    if (DrvDMA_OK != lRet)
+    {
+        std::cout << "ERROR  DrvDMA::Interrupt_Register  failed - " << lRet << std::endl;
+        Delivery_Stop();
+        return false;
+    }
+
+    if (nullptr != aReg)
+    {
+        // TODO  Configure the Intel chip
+        aReg[REG_IMS] = static_cast<uint32_t>(sMask);
+    }
+
+    return true;
+}
+
+void Delivery_Stop()
+{
+    switch (sDelivery)
+    {
+    case DELIVERY_BLOCKED:
+    case DELIVERY_CALLBACK:
+        if (nullptr != sReg)
+        {
+            sReg[REG_IMC] = static_cast<uint32_t>(sMask);
+        }
+
+        // Returns an error when Delivery_Start failed to register.
+        sDD->Interrupt_Unregister();
+        break;
+
+    case DELIVERY_POLL:
+        Trigger_SetPolling(false);
+
+        sReg[REG_GPIE] = sGPIE;
+        break;
+
+    default: assert(false);
+    }
+
+    if (sThread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lLock(sMutex);
+
+            sStop = true;
+        }
+
+        sCondition.notify_one();
+
+        sThread.join();
+    }
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+// ===== Entry point ========================================================
+
+void Blocked_OnInterrupt(void*, uint64_t aInterrupts)
+{
+    {
+        std::lock_guard<std::mutex> lLock(sMutex);
+
+        // When the waiter is late, the interrupts accumulate as the
+        // coalesced causes of a single wake up.
+        sPending |= (0 == aInterrupts) ? 1 : aInterrupts;
+    }
+
+    sCondition.notify_one();
+}
+
+// The waiter thread, what an application blocked on a semaphore or an
+// event sees. DrvDMA has no blocking interrupt wait, so the callback wakes
+// it.
+void Blocked_Run()
+{
+    std::unique_lock<std::mutex> lLock(sMutex);
+
+    for (;;)
+    {
+        sCondition.wait(lLock, [] { return (0 != sPending) || sStop; });
+
+        if (0 == sPending)
+        {
+            break;
+        }
+
+        Sample lSample;
+
+        // Time stamp first, the rest is not part of the measure.
+        lSample.OnInterrupt(sPending);
+
+        auto lInterrupts = sPending;
+
+        sPending = 0;
+
+        lLock.unlock();
+
+        Trigger_OnNotification(sCapture, &lSample, lInterrupts);
+
+        lLock.lock();
+    }
+}
+
+// The poller thread spins on ICR, no interrupt is involved.
+void Poll_Run()
+{
+    while (!sStop)
+    {
+        uint64_t lICR = sReg[REG_ICR];
+
+        if (0 != (lICR & sMask))
+        {
+            Sample lSample;
+
+            lSample.OnInterrupt(lICR);
+
+            Trigger_OnNotification(sCapture, &lSample, lICR);
+        }
+    }
+}
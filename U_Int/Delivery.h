@@ -0,0 +1,29 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/Delivery.h
+
+#pragma once
+
+// ===== DrvDMA =============================================================
+#include <DrvDMA_U.h>
+
+// ===== Local ==============================================================
+#include "Capture.h"
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+// Return  The name used by --delivery
+extern const char* Delivery_GetName(Delivery aDelivery);
+
+// Start delivering the interrupts to the Capture instance, see Delivery
+//
+// aReg  The 82576 registers, nullptr for the sim trigger. The poll model
+//       needs them.
+//
+// Return  false if DrvDMA::Interrupt_Register failed
+extern bool Delivery_Start(Delivery aDelivery, DrvDMA* aDD, volatile uint32_t* aReg, const Options& aOptions, Capture* aCapture);
+
+extern void Delivery_Stop();
@@ -0,0 +1,194 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/Load.cpp
+
+#include "Component.h"
+
+// ===== C++ ================================================================
+#include <thread>
+
+#ifdef _KMS_LINUX_
+    // ===== System =========================================================
+    #include <sched.h>
+#endif
+
+// ===== Local ==============================================================
+#include "Load.h"
+#include "Thread.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+// Larger than the last level cache, so the copies go to the memory
+#define MEMORY_SIZE_byte (64 * 1024 * 1024)
+
+// Count the operations by block, not to make the shared counter a load
+#define OPERATION_BLOCK (1024)
+
+static const char* NAMES[LOAD_QTY] = { "cpu" , "mem" , "sys"     };
+static const char* UNITS[LOAD_QTY] = { "loop", "byte", "syscall" };
+
+// Variables
+// //////////////////////////////////////////////////////////////////////////
+
+static std::atomic<uint64_t> sOperations;
+static std::atomic<bool>     sStop;
+
+static unsigned int sThreadQty;
+static std::thread  sThreads[LOAD_CPU_QTY_MAX];
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static void Cpu    (unsigned int aCpu);
+static void Memory (unsigned int aCpu);
+static void Syscall(unsigned int aCpu);
+
+static void Setup(unsigned int aCpu);
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+const char* Load_GetName(LoadType aType)
+{
+    assert(LOAD_QTY > aType);
+
+    return NAMES[aType];
+}
+
+const char* Load_GetUnit(LoadType aType)
+{
+    assert(LOAD_QTY > aType);
+
+    return UNITS[aType];
+}
+
+void Load_Start(LoadType aType, const Options& aOptions)
+{
+    assert(0 == sThreadQty);
+
+    sOperations = 0;
+    sStop       = false;
+
+    sThreadQty = (0 < aOptions.mLoadCpuQty) ? aOptions.mLoadCpuQty : 1;
+
+    for (unsigned int i = 0; i < sThreadQty; i++)
+    {
+        auto lCpu = (0 < aOptions.mLoadCpuQty) ? aOptions.mLoadCpus[i] : THREAD_KEEP;
+
+        switch (aType)
+        {
+        case LOAD_CPU    : sThreads[i] = std::thread(Cpu    , lCpu); break;
+        case LOAD_MEMORY : sThreads[i] = std::thread(Memory , lCpu); break;
+        case LOAD_SYSCALL: sThreads[i] = std::thread(Syscall, lCpu); break;
+
+        default: assert(false);
+        }
+    }
+}
+
+uint64_t Load_Stop()
+{
+    sStop = true;
+
+    for (unsigned int i = 0; i < sThreadQty; i++)
+    {
+        sThreads[i].join();
+    }
+
+    sThreadQty = 0;
+
+    return sOperations;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+// Keep the integer units busy, without memory access
+void Cpu(unsigned int aCpu)
+{
+    Setup(aCpu);
+
+    uint64_t lValue = 1;
+
+    while (!sStop)
+    {
+        for (unsigned int i = 0; i < OPERATION_BLOCK; i++)
+        {
+            lValue = lValue * 6364136223846793005ULL + 1442695040888963407ULL;
+        }
+
+        sOperations += OPERATION_BLOCK;
+    }
+
+    // Use the result, so the compiler keeps the loop.
+    if (0 == lValue)
+    {
+        std::cout << "";
+    }
+}
+
+// Copy a buffer larger than the cache back and forth
+void Memory(unsigned int aCpu)
+{
+    Setup(aCpu);
+
+    auto lBuffer = new uint8_t[MEMORY_SIZE_byte];
+
+    // Touch all the pages before the measure.
+    memset(lBuffer, 0, MEMORY_SIZE_byte);
+
+    auto lHalf_byte = MEMORY_SIZE_byte / 2;
+
+    uint8_t* lDst = lBuffer;
+    uint8_t* lSrc = lBuffer + lHalf_byte;
+
+    while (!sStop)
+    {
+        memcpy(lDst, lSrc, lHalf_byte);
+
+        auto lTmp = lDst;
+        lDst = lSrc;
+        lSrc = lTmp;
+
+        sOperations += lHalf_byte;
+    }
+
+    delete[] lBuffer;
+}
+
+// Enter and leave the kernel as often as possible
+void Syscall(unsigned int aCpu)
+{
+    Setup(aCpu);
+
+    while (!sStop)
+    {
+        for (unsigned int i = 0; i < OPERATION_BLOCK; i++)
+        {
+            #ifdef _KMS_LINUX_
+                sched_yield();
+            #endif
+
+            #ifdef _KMS_WINDOWS_
+                SwitchToThread();
+            #endif
+        }
+
+        sOperations += OPERATION_BLOCK;
+    }
+}
+
+// The thread inherits the class of the thread starting it. A load in the
+// SCHED_FIFO class of a --trigger-fifo thread would starve the test.
+void Setup(unsigned int aCpu)
+{
+    Thread_SetPriority(0);
+
+    if ((THREAD_KEEP != aCpu) && !Thread_SetAffinity(aCpu))
+    {
+        std::cout << "WARNING  Cannot run a load thread on the core " << aCpu << std::endl;
+    }
+}
@@ -0,0 +1,26 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/Load.h
+
+#pragma once
+
+// ===== Local ==============================================================
+#include "Options.h"
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+// Return  The name used by --load
+extern const char* Load_GetName(LoadType aType);
+
+// Return  The unit of the operations Load_Stop returns
+extern const char* Load_GetUnit(LoadType aType);
+
+// Start one thread of this load on each --load-cpus core or, without
+// --load-cpus, a single thread the OS schedules.
+extern void Load_Start(LoadType aType, const Options& aOptions);
+
+// Return  The count of operations all the threads executed
+extern uint64_t Load_Stop();
@@ -0,0 +1,110 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/Options.h
+
+#pragma once
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+#define LOAD_CPU_QTY_MAX  (64)
+#define PLACEMENT_QTY_MAX (8)
+#define RATE_QTY_MAX      (16)
+#define VECTOR_QTY_MAX    (8)
+
+// Data types
+// //////////////////////////////////////////////////////////////////////////
+
+typedef enum
+{
+    CLOCK_SOURCE_OS,  // CLOCK_MONOTONIC or QueryPerformanceCounter
+    CLOCK_SOURCE_TSC, // rdtscp, calibrated against the OS clock
+}
+ClockSource;
+
+typedef enum
+{
+    DELIVERY_BLOCKED,  // The callback wakes a thread blocked waiting
+    DELIVERY_CALLBACK, // The DrvDMA callback
+    DELIVERY_POLL,     // A thread polls the Intel 82576 ICR register
+
+    DELIVERY_QTY
+}
+Delivery;
+
+typedef enum
+{
+    FORMAT_BINARY, // See CaptureFile.h
+    FORMAT_NONE,   // Only the statistics
+    FORMAT_TEXT,   // One line per sample, ';' separated
+}
+Format;
+
+typedef enum
+{
+    LOAD_CPU,     // Integer arithmetic, without memory access
+    LOAD_MEMORY,  // Copy a buffer larger than the cache
+    LOAD_SYSCALL, // sched_yield or SwitchToThread in a loop
+
+    LOAD_QTY
+}
+LoadType;
+
+typedef enum
+{
+    TRIGGER_NIC,      // Write the Intel 82576 ICS register
+    TRIGGER_SIMULATE, // DrvDMA::Interrupt_Simulate, no NIC needed
+}
+Trigger;
+
+typedef enum
+{
+    VECTOR_MODE_ALL,         // Trigger all the vectors at each iteration
+    VECTOR_MODE_ROUND_ROBIN, // Trigger one vector at each iteration
+}
+VectorMode;
+
+// The values of a --callback-... or --trigger-... option
+typedef struct
+{
+    unsigned int mQty; // 0 means the option is not used
+    unsigned int mValues[PLACEMENT_QTY_MAX];
+}
+Placement;
+
+typedef struct
+{
+    const char* mInput;
+    const char* mOutput;
+
+    ClockSource mClockSource;
+
+    Format mFormat;
+
+    Trigger mTrigger;
+
+    VectorMode mVectorMode;
+
+    bool mBenchStats;
+    bool mHistogram;
+
+    Placement mCallbackCpus;
+    Placement mCallbackFifos;
+    Placement mTriggerCpus;
+    Placement mTriggerFifos;
+
+    unsigned int mDeliveries; // Bit mask, 1 << Delivery
+    unsigned int mDevice;
+    unsigned int mIteration;
+    unsigned int mLoadCpuQty;
+    unsigned int mLoadCpus[LOAD_CPU_QTY_MAX];
+    unsigned int mLoads; // Bit mask, 1 << LoadType
+    unsigned int mPeriod_ms;
+    unsigned int mRateQty;
+    unsigned int mRates_Hz[RATE_QTY_MAX];
+    unsigned int mVectorQty;
+    unsigned int mWindow_s;
+}
+Options;
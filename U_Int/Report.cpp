@@ -0,0 +1,138 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/Report.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "Report.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+static const double PERCENTS[] = { 50.0, 90.0, 99.0, 99.9, 99.99 };
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static void DisplayPercentiles(const char* aName, const Stats& aStats);
+
+static void DisplayStats(const Options& aOptions, const Stats& aTrig, const Stats& aUser);
+
+static void DisplayWindow(const Capture& aCapture);
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+void Report_Compare(const std::string* aNames, const Stats* aTrig, const Stats* aUser, unsigned int aQty)
+{
+    assert(nullptr != aNames);
+    assert(nullptr != aTrig);
+    assert(nullptr != aUser);
+
+    std::cout << "===== Comparison =====\n";
+    std::cout << "Configuration;Trig_p50_us;Trig_p99_us;Trig_p99.9_us;Trig_Max_us;User_p50_us;User_p99_us;User_p99.9_us;User_Max_us\n";
+
+    for (unsigned int i = 0; i < aQty; i++)
+    {
+        std::cout << aNames[i] << ";";
+        std::cout << aTrig[i].GetPercentile(50.0) << ";" << aTrig[i].GetPercentile(99.0) << ";" << aTrig[i].GetPercentile(99.9) << ";" << aTrig[i].GetMax() << ";";
+        std::cout << aUser[i].GetPercentile(50.0) << ";" << aUser[i].GetPercentile(99.0) << ";" << aUser[i].GetPercentile(99.9) << ";" << aUser[i].GetMax() << std::endl;
+    }
+}
+
+void Report_Display(const Options& aOptions, const Capture& aCapture, double aOverhead_us)
+{
+    auto lVectorQty = aCapture.GetVectorQty();
+
+    if (1 == lVectorQty)
+    {
+        DisplayStats(aOptions, aCapture.GetTrig(0), aCapture.GetUser(0));
+    }
+    else
+    {
+        for (unsigned int v = 0; v < lVectorQty; v++)
+        {
+            std::cout << "===== Vector " << v << " =====" << std::endl;
+
+            DisplayStats(aOptions, aCapture.GetTrig(v), aCapture.GetUser(v));
+        }
+
+        std::cout << "===== All vectors =====" << std::endl;
+
+        DisplayStats(aOptions, aCapture.GetTrig(), aCapture.GetUser());
+    }
+
+    if (0 < aCapture.GetWindow_s())
+    {
+        DisplayWindow(aCapture);
+    }
+
+    // The trigger time contains the cost of one time stamp, the user time
+    // contains the cost of one time stamp too, but split between the
+    // trigger thread and the callback.
+    if (0.0 < aOverhead_us)
+    {
+        std::cout << "Time stamp overhead : " << aOverhead_us << " us, included once in each Trigger and User time" << std::endl;
+    }
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+void DisplayPercentiles(const char* aName, const Stats& aStats)
+{
+    std::cout << aName << " :";
+
+    for (auto lPercent : PERCENTS)
+    {
+        std::cout << " p" << lPercent << " = " << aStats.GetPercentile(lPercent) << " us";
+    }
+
+    std::cout << std::endl;
+}
+
+void DisplayStats(const Options& aOptions, const Stats& aTrig, const Stats& aUser)
+{
+    std::cout << "Trigger : " << aTrig << std::endl;
+    std::cout << "User    : " << aUser << std::endl;
+
+    DisplayPercentiles("Trigger", aTrig);
+    DisplayPercentiles("User   ", aUser);
+
+    if (aOptions.mHistogram)
+    {
+        std::cout << "Trigger histogram\nLow_us;High_us;Count;Cumulative_%\n";
+        aTrig.Dump(std::cout);
+
+        std::cout << "User histogram\nLow_us;High_us;Count;Cumulative_%\n";
+        aUser.Dump(std::cout);
+    }
+}
+
+// The window ends with the last sample. After a long run, it shows the end
+// of the run, where the statistics of DisplayStats mix all of it.
+void DisplayWindow(const Capture& aCapture)
+{
+    auto lDecay    = aCapture.GetUserDecay();
+    auto lWindow   = aCapture.GetUserWindow();
+    auto lWindow_s = aCapture.GetWindow_s();
+
+    auto lName = "User, last " + std::to_string(lWindow_s) + " s";
+
+    std::cout << lName << " : " << lWindow << std::endl;
+    std::cout << "User, decaying, tau = " << lWindow_s << " s : Weight = " << lDecay->GetCount() << ", Average = " << lDecay->GetAverage() << " us" << std::endl;
+
+    DisplayPercentiles(lName.c_str(), lWindow);
+
+    std::cout << "User, decaying :";
+
+    for (auto lPercent : PERCENTS)
+    {
+        std::cout << " p" << lPercent << " = " << lDecay->GetPercentile(lPercent) << " us";
+    }
+
+    std::cout << std::endl;
+}
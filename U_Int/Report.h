@@ -0,0 +1,31 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/Report.h
+
+#pragma once
+
+// ===== C++ ================================================================
+#include <string>
+
+// ===== Local ==============================================================
+#include "Capture.h"
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+// Display one line of percentiles for each configuration
+//
+// aNames  The names of the configurations
+// aTrig   The trigger statistics of each configuration
+// aUser   The user statistics of each configuration
+extern void Report_Compare(const std::string* aNames, const Stats* aTrig, const Stats* aUser, unsigned int aQty);
+
+// Display the trigger and user statistics, their percentiles and, with
+// --histogram, their histograms. With more than one vector, display them
+// for each vector, then for all the vectors merged. With --window-s,
+// display the user percentiles over the window and decaying.
+//
+// aOverhead_us  The cost of a time stamp, 0.0 if unknown
+extern void Report_Display(const Options& aOptions, const Capture& aCapture, double aOverhead_us);
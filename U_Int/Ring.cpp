@@ -0,0 +1,65 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/Ring.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "Ring.h"
+
+// Public
+// //////////////////////////////////////////////////////////////////////////
+
+Ring::Ring(unsigned int aCapacity) : mMask(aCapacity - 1), mHead(0), mDropped(0), mTail(0)
+{
+    assert(0 < aCapacity);
+    assert(0 == (aCapacity & mMask));
+
+    mSamples = new Sample[aCapacity];
+}
+
+Ring::~Ring()
+{
+    assert(nullptr != mSamples);
+
+    delete[] mSamples;
+}
+
+uint64_t Ring::GetDropped() const { return mDropped.load(std::memory_order_relaxed); }
+
+bool Ring::Pop(Sample* aOut)
+{
+    assert(nullptr != aOut);
+
+    auto lTail = mTail.load(std::memory_order_relaxed);
+
+    if (mHead.load(std::memory_order_acquire) == lTail)
+    {
+        return false;
+    }
+
+    *aOut = mSamples[lTail & mMask];
+
+    mTail.store(lTail + 1, std::memory_order_release);
+
+    return true;
+}
+
+bool Ring::Push(const Sample& aIn)
+{
+    auto lHead = mHead.load(std::memory_order_relaxed);
+
+    if (mMask < lHead - mTail.load(std::memory_order_acquire))
+    {
+        mDropped.store(mDropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    mSamples[lHead & mMask] = aIn;
+
+    mHead.store(lHead + 1, std::memory_order_release);
+
+    return true;
+}
@@ -0,0 +1,55 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/Ring.h
+
+#pragma once
+
+// ===== Local ==============================================================
+#include "Sample.h"
+
+// A lock free ring of samples with one producer thread and one consumer
+// thread. Push never waits: when the ring is full, it drops the sample and
+// counts it.
+class Ring
+{
+
+public:
+
+    // aCapacity  A power of 2
+    Ring(unsigned int aCapacity);
+
+    ~Ring();
+
+    // Return  The count of samples Push dropped
+    uint64_t GetDropped() const;
+
+    // Consumer
+    //
+    // Return  false if the ring is empty
+    bool Pop(Sample* aOut);
+
+    // Producer
+    //
+    // Return  false if the ring is full
+    bool Push(const Sample& aIn);
+
+private:
+
+    Ring(const Ring&);
+
+    const Ring& operator = (const Ring&);
+
+    unsigned int mMask;
+    Sample     * mSamples;
+
+    // The producer writes mHead and mDropped, the consumer writes mTail.
+    // They are on different cache lines so the two threads do not share
+    // a modified line at each sample.
+    alignas(64) std::atomic<unsigned int> mHead;
+    std::atomic<uint64_t> mDropped;
+
+    alignas(64) std::atomic<unsigned int> mTail;
+
+};
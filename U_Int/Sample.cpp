@@ -8,39 +8,40 @@
 #include "Component.h"
 
 // ===== Local ==============================================================
+#include "Clock.h"
+
 #include "Sample.h"
 
 // Public
 // //////////////////////////////////////////////////////////////////////////
 
-Sample::Sample() : mBeforeTrig(0), mAfterTrig(0), mOnInterrupt(0), mInterrupts(0), mIteration(0) {}
+Sample::Sample() : mBeforeTrig(0), mAfterTrig(0), mOnInterrupt(0), mInterrupts(0), mIteration(0), mVector(0)
+{
+    // The capture files contain the instances as they are in memory.
+    static_assert(40 == sizeof(Sample), "Sample size");
+}
+
+unsigned int Sample::GetIteration() const { return mIteration; }
+unsigned int Sample::GetVector   () const { return mVector   ; }
+
+uint64_t Sample::GetTime() const { return mBeforeTrig; }
 
-double Sample::GetTrig() const
+double Sample::GetTrig(uint64_t aFrequency) const
 {
     assert(mAfterTrig >= mBeforeTrig);
 
     uint64_t lTrig = mAfterTrig - mBeforeTrig;
 
-    double lResult_us = static_cast<double>(lTrig);
-
-    lResult_us /= gFrequency;
-    lResult_us *= 1000000;
-
-    return lResult_us;
+    return Clock_ToMicroSeconds(lTrig, aFrequency);
 }
 
-double Sample::GetUser() const
+double Sample::GetUser(uint64_t aFrequency) const
 {
     assert(mBeforeTrig <= mOnInterrupt);
 
     uint64_t lUser = mOnInterrupt - mBeforeTrig;
 
-    double lResult_us = static_cast<double>(lUser);
-
-    lResult_us /= gFrequency;
-    lResult_us *= 1000000;
-
-    return lResult_us;
+    return Clock_ToMicroSeconds(lUser, aFrequency);
 }
 
 bool Sample::IsValid() const
@@ -53,29 +54,41 @@ bool Sample::IsValid() const
 
 void Sample::BeforeTrig(unsigned int aIteration)
 {
-    auto lRetB = QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&mBeforeTrig));
-    assert(lRetB);
+    mBeforeTrig = Clock_GetNow();
 
     mIteration = aIteration;
 }
 
 void Sample::AfterTrig()
 {
-    auto lRetB = QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&mAfterTrig));
-    assert(lRetB);
+    mAfterTrig = Clock_GetNow();
 }
 
 void Sample::OnInterrupt(uint64_t aInterrupts)
 {
-    auto lRetB = QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&mOnInterrupt));
-    assert(lRetB);
+    mOnInterrupt = Clock_GetNow();
 
     mInterrupts = aInterrupts;
 }
 
+void Sample::Merge(const Sample& aInterrupt)
+{
+    assert(mIteration == aInterrupt.mIteration);
+    assert(mVector    == aInterrupt.mVector);
+
+    mInterrupts  = aInterrupt.mInterrupts;
+    mOnInterrupt = aInterrupt.mOnInterrupt;
+}
+
+void Sample::SetId(unsigned int aVector, unsigned int aIteration)
+{
+    mIteration = aIteration;
+    mVector    = aVector;
+}
+
 std::ostream& operator << (std::ostream& aOut, const Sample& aIn)
 {
-    aOut << aIn.mBeforeTrig << ";" << aIn.mAfterTrig << ";" << aIn.mOnInterrupt << ";" << aIn.mInterrupts << ";" << aIn.mIteration;
+    aOut << aIn.mBeforeTrig << ";" << aIn.mAfterTrig << ";" << aIn.mOnInterrupt << ";" << aIn.mInterrupts << ";" << aIn.mIteration << ";" << aIn.mVector;
 
     return aOut;
 }
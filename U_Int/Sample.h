@@ -7,6 +7,12 @@
 
 #pragma once
 
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+// Iteration of an interrupt received before the first trigger
+#define SAMPLE_ITERATION_NONE (0xffffffff)
+
 class Sample
 {
 
@@ -14,15 +20,33 @@ public:
 
     Sample();
 
-    double GetTrig() const;
-    double GetUser() const;
+    unsigned int GetIteration() const;
+    unsigned int GetVector   () const;
+
+    // Return  The time stamp taken before the trigger, in ticks
+    uint64_t GetTime() const;
+
+    // aFrequency  The frequency of the counter used for the time stamps
+    double GetTrig(uint64_t aFrequency) const;
+    double GetUser(uint64_t aFrequency) const;
 
     bool IsValid() const;
 
     void BeforeTrig(unsigned int aIteration);
     void AfterTrig();
+
+    // aInterrupts  The interrupt bits the callback received
     void OnInterrupt(uint64_t aInterrupts);
 
+    // aInterrupt  A sample OnInterrupt filled, for the same vector and
+    //             iteration
+    void Merge(const Sample& aInterrupt);
+
+    // aVector     The index of the interrupt bit
+    // aIteration  The iteration of the trigger, for an interrupt sample the
+    //             one of the last trigger of this vector
+    void SetId(unsigned int aVector, unsigned int aIteration);
+
     friend std::ostream& operator << (std::ostream& aOut, const Sample& aIn);
 
 private:
@@ -34,5 +58,6 @@ private:
     uint64_t mInterrupts;
 
     unsigned int mIteration;
+    unsigned int mVector;
 
 };
@@ -7,101 +7,419 @@
 
 #include "Component.h"
 
+#if defined(__x86_64__) || defined(_M_X64)
+    #define STATS_SSE2
+
+    // ===== C ==============================================================
+    #include <emmintrin.h>
+#endif
+
 // ===== Local ==============================================================
 #include "Stats.h"
 
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+// The samples AddSamples converts at once, on the stack
+#define BLOCK_QTY (256)
+
+// Adding then subtracting 2 ^ 52 rounds a positive double below 2 ^ 52 to
+// the nearest integer.
+#define ROUND_MAGIC (4503599627370496.0)
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static unsigned int Bucket_GetIndex(double aValue_us);
+static uint64_t     Bucket_GetLow  (unsigned int aIndex);
+static uint64_t     Bucket_GetWidth(unsigned int aIndex);
+
 // Public
 // //////////////////////////////////////////////////////////////////////////
 
-Stats::Stats() : mN(0), mSum(0.0), mSum2(0.0) {}
+Stats::Stats()
+{
+    memset(&mMoments, 0, sizeof(mMoments));
+    memset(&mBuckets, 0, sizeof(mBuckets));
+}
+
+double Stats::GetAverage() const { return mMoments.mMean; }
+
+uint64_t Stats::GetCount() const { return mMoments.mN; }
 
-double Stats::GetAverage() const
+double Stats::GetMax() const { return mMoments.mMax; }
+double Stats::GetMin() const { return mMoments.mMin; }
+
+double Stats::GetPercentile(double aPercent) const
 {
+    assert(0.0 <= aPercent);
+    assert(100.0 >= aPercent);
+
     double lResult = 0.0;
 
-    if (0 < mN)
+    auto lN = mMoments.mN;
+
+    if (0 < lN)
     {
-        lResult = mSum;
-        lResult /= mN;
+        auto lRank = static_cast<uint64_t>(ceil(aPercent * lN / 100.0));
+        if (0 == lRank)
+        {
+            lRank = 1;
+        }
+
+        uint64_t lCount = 0;
+
+        for (unsigned int i = 0; i < STATS_BUCKET_QTY; i++)
+        {
+            lCount += mBuckets[i];
+            if (lRank <= lCount)
+            {
+                lResult = GetMiddle(i);
+                break;
+            }
+        }
+
+        if (mMoments.mMin > lResult) { lResult = mMoments.mMin; }
+        if (mMoments.mMax < lResult) { lResult = mMoments.mMax; }
     }
 
     return lResult;
 }
 
-unsigned int Stats::GetCount() const { return mN; }
-
-double Stats::GetMax() const
+double Stats::GetStdDev() const
 {
     double lResult = 0.0;
 
-    if (0 < mN)
+    if (2 <= mMoments.mN)
     {
-        lResult = mMax;
+        lResult = sqrt(mMoments.mM2 / (mMoments.mN - 1));
     }
 
     return lResult;
 }
 
-double Stats::GetMin() const
+void Stats::AddSample(double aValue)
 {
-    double lResult = 0.0;
+    Moments_Add(&mMoments, aValue);
+
+    mBuckets[Bucket_GetIndex(aValue)]++;
+}
+
+void Stats::AddSamples(const uint64_t* aTicks, unsigned int aCount, uint64_t aFrequency)
+{
+    assert(nullptr != aTicks);
+    assert(0 < aFrequency);
+
+    auto lScale_us = 1000000.0 / aFrequency;
 
-    if (0 < mN)
+    for (unsigned int i = 0; i < aCount; i += BLOCK_QTY)
     {
-        lResult = mMin;
-    }
+        auto lCount = aCount - i;
+        if (BLOCK_QTY < lCount)
+        {
+            lCount = BLOCK_QTY;
+        }
 
-    return lResult;
+        uint64_t lIndexes[BLOCK_QTY];
+        Moments  lMoments;
+
+        Block_Convert(aTicks + i, lCount, lScale_us, lIndexes, &lMoments);
+
+        // The increments stay scalar, two values of a block often fall in
+        // the same bucket.
+        for (unsigned int j = 0; j < lCount; j++)
+        {
+            mBuckets[lIndexes[j]]++;
+        }
+
+        Moments_Merge(&mMoments, lMoments);
+    }
 }
 
-double Stats::GetStdDev() const
+void Stats::Dump(std::ostream& aOut) const
 {
-    assert(0.0 <= mSum2);
+    uint64_t lCount = 0;
 
-    double lResult = 0.0;
-    
-    if (2 <= mN)
+    for (unsigned int i = 0; i < STATS_BUCKET_QTY; i++)
     {
-        lResult = mSum2;
-        lResult -= mSum * mSum / mN;
-        lResult /= mN - 1;
+        if (0 < mBuckets[i])
+        {
+            lCount += mBuckets[i];
 
-        assert(0 < lResult);
+            auto lLow_ns = Bucket_GetLow(i);
 
-        lResult = sqrt(lResult);
+            aOut << (lLow_ns / 1000.0) << ";" << ((lLow_ns + Bucket_GetWidth(i)) / 1000.0) << ";" << mBuckets[i] << ";" << (100.0 * lCount / mMoments.mN) << "\n";
+        }
     }
-
-    return lResult;
 }
 
-void Stats::AddSample(double aValue)
+void Stats::Merge(const Stats& aIn)
 {
-    if (0 == mN)
+    if (0 < aIn.mMoments.mN)
     {
-        mMax = aValue;
-        mMin = aValue;
+        Moments_Merge(&mMoments, aIn.mMoments);
+
+        for (unsigned int i = 0; i < STATS_BUCKET_QTY; i++)
+        {
+            mBuckets[i] += aIn.mBuckets[i];
+        }
     }
-    else
-    {
-        if (mMax < aValue)
+}
+
+std::ostream& operator << (std::ostream& aOut, const Stats& aIn)
+{
+    aOut << aIn.GetMin() << " us < " << aIn.GetAverage() << " us < " << aIn.GetMax() << " us ; " << aIn.GetStdDev() << " us ( " << aIn.GetCount() << " )";
+
+    return aOut;
+}
+
+// Private
+// //////////////////////////////////////////////////////////////////////////
+
+unsigned int Stats::GetIndex(double aValue_us) { return Bucket_GetIndex(aValue_us); }
+
+double Stats::GetMiddle(unsigned int aIndex)
+{
+    double lResult_ns = static_cast<double>(Bucket_GetLow(aIndex)) + static_cast<double>(Bucket_GetWidth(aIndex) - 1) / 2.0;
+
+    return lResult_ns / 1000.0;
+}
+
+// The block is small, so the two pass variance, first the mean, then the
+// squared deviations, is accurate. Moments_Merge then adds the block to
+// the running moments.
+//
+// SSE2 converts two values at a time. The bucket index comes from the bits
+// of the rounded value in ns: for 64 ns and more, the exponent and the 6
+// most significant bits of the mantissa, shifted right by 46, are
+// (MSB + 1023) * 64 + the 6 bits following the MSB, which Bucket_GetIndex
+// computes as (MSB - 5) * 64 + the same 6 bits.
+void Stats::Block_Convert(const uint64_t* aTicks, unsigned int aCount, double aScale_us, uint64_t* aIndexes, Moments* aOut)
+{
+    assert(nullptr != aTicks);
+    assert(0 < aCount);
+    assert(BLOCK_QTY >= aCount);
+    assert(nullptr != aIndexes);
+    assert(nullptr != aOut);
+
+    double lValues_us[BLOCK_QTY];
+
+    unsigned int i = 0;
+
+    double lMax = static_cast<double>(aTicks[0]) * aScale_us;
+    double lMin = lMax;
+    double lSum = 0.0;
+
+    #ifdef STATS_SSE2
+        auto lMagic   = _mm_set1_pd(ROUND_MAGIC);
+        auto lMaxV    = _mm_set1_pd(lMax);
+        auto lMinV    = lMaxV;
+        auto lScaleV  = _mm_set1_pd(aScale_us);
+        auto lSumV    = _mm_setzero_pd();
+        auto lLinear  = _mm_set1_pd(static_cast<double>(STATS_SUB_HALF));
+        auto lLast    = _mm_set1_pd(static_cast<double>(1ULL << STATS_MSB_MAX));
+        auto lBias    = _mm_set1_epi64x((1023 + STATS_SUB_BITS - 2) * STATS_SUB_HALF);
+        auto lLastIdx = _mm_set1_epi64x(STATS_BUCKET_QTY - 1);
+
+        for (; i + 2 <= aCount; i += 2)
         {
-            mMax = aValue;
+            auto lUs = _mm_mul_pd(_mm_set_pd(static_cast<double>(aTicks[i + 1]), static_cast<double>(aTicks[i])), lScaleV);
+
+            _mm_storeu_pd(lValues_us + i, lUs);
+
+            lMaxV = _mm_max_pd(lMaxV, lUs);
+            lMinV = _mm_min_pd(lMinV, lUs);
+            lSumV = _mm_add_pd(lSumV, lUs);
+
+            auto lShifted = _mm_add_pd(_mm_mul_pd(lUs, _mm_set1_pd(1000.0)), lMagic);
+            auto lNs      = _mm_sub_pd(lShifted, lMagic);
+
+            // Below 2 ^ 52, the low bits of lShifted are the integer value.
+            auto lIdxLin = _mm_sub_epi64(_mm_castpd_si128(lShifted), _mm_castpd_si128(lMagic));
+            auto lIdxLog = _mm_sub_epi64(_mm_srli_epi64(_mm_castpd_si128(lNs), 52 - (STATS_SUB_BITS - 1)), lBias);
+
+            auto lIsLin  = _mm_castpd_si128(_mm_cmplt_pd(lNs, lLinear));
+            auto lIsLast = _mm_castpd_si128(_mm_cmpge_pd(lNs, lLast));
+
+            auto lIdx = _mm_or_si128(_mm_and_si128(lIsLin , lIdxLin ), _mm_andnot_si128(lIsLin , lIdxLog));
+            lIdx      = _mm_or_si128(_mm_and_si128(lIsLast, lLastIdx), _mm_andnot_si128(lIsLast, lIdx   ));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(aIndexes + i), lIdx);
         }
 
-        if (mMin > aValue)
+        double lTmp[2];
+
+        _mm_storeu_pd(lTmp, lMaxV); lMax = (lTmp[0] > lTmp[1]) ? lTmp[0] : lTmp[1];
+        _mm_storeu_pd(lTmp, lMinV); lMin = (lTmp[0] < lTmp[1]) ? lTmp[0] : lTmp[1];
+        _mm_storeu_pd(lTmp, lSumV); lSum = lTmp[0] + lTmp[1];
+    #endif
+
+    for (; i < aCount; i++)
+    {
+        auto lValue_us = static_cast<double>(aTicks[i]) * aScale_us;
+
+        lValues_us[i] = lValue_us;
+
+        if (lMax < lValue_us) { lMax = lValue_us; }
+        if (lMin > lValue_us) { lMin = lValue_us; }
+
+        lSum += lValue_us;
+
+        aIndexes[i] = Bucket_GetIndex(lValue_us);
+    }
+
+    auto lMean = lSum / aCount;
+    auto lM2   = 0.0;
+
+    i = 0;
+
+    #ifdef STATS_SSE2
+        auto lMeanV = _mm_set1_pd(lMean);
+        auto lM2V   = _mm_setzero_pd();
+
+        for (; i + 2 <= aCount; i += 2)
         {
-            mMin = aValue;
+            auto lDelta = _mm_sub_pd(_mm_loadu_pd(lValues_us + i), lMeanV);
+
+            lM2V = _mm_add_pd(lM2V, _mm_mul_pd(lDelta, lDelta));
         }
+
+        _mm_storeu_pd(lTmp, lM2V);
+
+        lM2 = lTmp[0] + lTmp[1];
+    #endif
+
+    for (; i < aCount; i++)
+    {
+        auto lDelta = lValues_us[i] - lMean;
+
+        lM2 += lDelta * lDelta;
     }
 
-    mN++;
-    mSum += aValue;
-    mSum2 += aValue * aValue;
+    aOut->mN    = aCount;
+    aOut->mM2   = lM2;
+    aOut->mMax  = lMax;
+    aOut->mMean = lMean;
+    aOut->mMin  = lMin;
 }
 
-std::ostream& operator << (std::ostream& aOut, const Stats& aIn)
+void Stats::Moments_Add(Moments* aInOut, double aValue)
 {
-    aOut << aIn.GetMin() << " us < " << aIn.GetAverage() << " us < " << aIn.GetMax() << " us ; " << aIn.GetStdDev() << " us ( " << aIn.GetCount() << " )";
+    assert(nullptr != aInOut);
 
-    return aOut;
+    if (0 == aInOut->mN)
+    {
+        aInOut->mMax = aValue;
+        aInOut->mMin = aValue;
+    }
+    else
+    {
+        if (aInOut->mMax < aValue) { aInOut->mMax = aValue; }
+        if (aInOut->mMin > aValue) { aInOut->mMin = aValue; }
+    }
+
+    aInOut->mN++;
+
+    auto lDelta = aValue - aInOut->mMean;
+
+    aInOut->mMean += lDelta / aInOut->mN;
+    aInOut->mM2   += lDelta * (aValue - aInOut->mMean);
+}
+
+// Chan's parallel form of Welford's algorithm
+void Stats::Moments_Merge(Moments* aInOut, const Moments& aIn)
+{
+    assert(nullptr != aInOut);
+
+    if (0 == aIn.mN)
+    {
+        return;
+    }
+
+    if (0 == aInOut->mN)
+    {
+        *aInOut = aIn;
+        return;
+    }
+
+    if (aInOut->mMax < aIn.mMax) { aInOut->mMax = aIn.mMax; }
+    if (aInOut->mMin > aIn.mMin) { aInOut->mMin = aIn.mMin; }
+
+    auto lN     = aInOut->mN + aIn.mN;
+    auto lDelta = aIn.mMean - aInOut->mMean;
+
+    aInOut->mMean += lDelta * aIn.mN / lN;
+    aInOut->mM2   += aIn.mM2 + lDelta * lDelta * aInOut->mN / lN * aIn.mN;
+    aInOut->mN     = lN;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+// Values below 2 ^ STATS_SUB_BITS ns use the bucket of the same index. For
+// the others, the shift keeps the STATS_SUB_BITS most significant bits, the
+// top one always set, so each shift owns STATS_SUB_HALF buckets.
+unsigned int Bucket_GetIndex(double aValue_us)
+{
+    if (0.0 >= aValue_us)
+    {
+        return 0;
+    }
+
+    double lValue_ns = aValue_us * 1000.0;
+
+    if (static_cast<double>(1ULL << STATS_MSB_MAX) <= lValue_ns)
+    {
+        return STATS_BUCKET_QTY - 1;
+    }
+
+    auto lValue = static_cast<uint64_t>(lValue_ns + 0.5);
+    if ((2 * STATS_SUB_HALF) > lValue)
+    {
+        return static_cast<unsigned int>(lValue);
+    }
+
+    unsigned int lMSB;
+
+    #ifdef _KMS_LINUX_
+        lMSB = 63 - __builtin_clzll(lValue);
+    #endif
+
+    #ifdef _KMS_WINDOWS_
+        unsigned long lIndex;
+
+        _BitScanReverse64(&lIndex, lValue);
+
+        lMSB = lIndex;
+    #endif
+
+    unsigned int lShift = lMSB - STATS_SUB_BITS + 1;
+
+    return lShift * STATS_SUB_HALF + static_cast<unsigned int>(lValue >> lShift);
+}
+
+uint64_t Bucket_GetLow(unsigned int aIndex)
+{
+    assert(STATS_BUCKET_QTY > aIndex);
+
+    if ((2 * STATS_SUB_HALF) > aIndex)
+    {
+        return aIndex;
+    }
+
+    unsigned int lShift = aIndex / STATS_SUB_HALF - 1;
+
+    return static_cast<uint64_t>(aIndex - lShift * STATS_SUB_HALF) << lShift;
+}
+
+uint64_t Bucket_GetWidth(unsigned int aIndex)
+{
+    assert(STATS_BUCKET_QTY > aIndex);
+
+    if ((2 * STATS_SUB_HALF) > aIndex)
+    {
+        return 1;
+    }
+
+    return 1ULL << (aIndex / STATS_SUB_HALF - 1);
 }
@@ -1,4 +1,3 @@
-
 // Author    KMS - Martin Dubois, P. Eng.
 // Copyright (C) 2026 KMS
 // License   http://www.apache.org/licenses/LICENSE-2.0
@@ -7,29 +6,98 @@
 
 #pragma once
 
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+// The histogram counts values in ns. It is linear, 1 ns per bucket, up to
+// 2 ^ STATS_SUB_BITS ns. Above, each power of 2 is split in
+// 2 ^ (STATS_SUB_BITS - 1) buckets, so a bucket is never wider than 1 / 64
+// of its value. Values above 2 ^ STATS_MSB_MAX ns (about 39 hours) go in the
+// last bucket.
+#define STATS_SUB_BITS (7)
+#define STATS_MSB_MAX  (47)
+
+#define STATS_SUB_HALF   (1 << (STATS_SUB_BITS - 1))
+#define STATS_BUCKET_QTY ((STATS_MSB_MAX - STATS_SUB_BITS + 3) * STATS_SUB_HALF)
+
 class Stats
 {
 
+    friend class StatsDecay;
+    friend class StatsShards;
+    friend class StatsWindow;
+
 public:
 
     Stats();
 
     double GetAverage() const;
-    unsigned int GetCount() const;
+    uint64_t GetCount() const;
     double GetMax() const;
     double GetMin() const;
+
+    // aPercent  0.0 to 100.0
+    //
+    // Return  The middle of the bucket containing the value, in us, clamped
+    //         between GetMin and GetMax
+    double GetPercentile(double aPercent) const;
+
     double GetStdDev() const;
 
+    // O(1), without allocation or lock, so it can be called from the
+    // interrupt callback.
     void AddSample(double aValue);
 
+    // Add a block of time stamp differences. Same result as AddSample with
+    // Clock_ToMicroSeconds for each, except for the rounding of the values
+    // at the limit of a bucket. On x86, the conversion, the bucket indexes
+    // and the moments use SSE2.
+    //
+    // aTicks      The differences, in ticks
+    // aFrequency  The frequency of the counter
+    void AddSamples(const uint64_t* aTicks, unsigned int aCount, uint64_t aFrequency);
+
+    // Write the non empty buckets, one per line
+    // Low_us;High_us;Count;Cumulative_%
+    void Dump(std::ostream& aOut) const;
+
+    // Add the samples of aIn to this instance
+    void Merge(const Stats& aIn);
+
 private:
 
-    unsigned int mN;
+    // Welford's streaming form. The mean and the sum of the squared
+    // deviations stay accurate after billions of samples, where
+    // Sum2 - Sum * Sum / N cancels out.
+    typedef struct
+    {
+        uint64_t mN;
+
+        double mM2; // Sum of the squared deviations from the mean
+        double mMax;
+        double mMean;
+        double mMin;
+    }
+    Moments;
+
+    static unsigned int GetIndex(double aValue_us);
+
+    // Return  The middle of the bucket, in us
+    static double GetMiddle(unsigned int aIndex);
+
+    // Convert a block, compute the bucket of each value and the moments
+    // of the block
+    //
+    // aIndexes [---;-W-] The bucket of each value
+    // aOut     [---;-W-] The moments of the block
+    static void Block_Convert(const uint64_t* aTicks, unsigned int aCount, double aScale_us, uint64_t* aIndexes, Moments* aOut);
+
+    static void Moments_Add  (Moments* aInOut, double aValue);
+    static void Moments_Merge(Moments* aInOut, const Moments& aIn);
+
+    Moments mMoments;
 
-    double mMax;
-    double mMin;
-    double mSum;
-    double mSum2;
+    uint64_t mBuckets[STATS_BUCKET_QTY];
 
 };
 
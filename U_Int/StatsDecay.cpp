@@ -0,0 +1,118 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/StatsDecay.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "StatsDecay.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+// exp(64) is about 6 * 10 ^ 27, far from the limit of a double, and the
+// older samples keep 1 / exp(64) of the weight, still above the smallest
+// double.
+#define RESCALE_TAU (64.0)
+
+// Public
+// //////////////////////////////////////////////////////////////////////////
+
+StatsDecay::StatsDecay(uint64_t aTau) : mTau(aTau)
+{
+    assert(0 < aTau);
+
+    Reset();
+}
+
+double StatsDecay::GetAverage() const
+{
+    return (0.0 < mTotal) ? (mSum / mTotal) : 0.0;
+}
+
+double StatsDecay::GetCount() const
+{
+    return mTotal / mScale;
+}
+
+double StatsDecay::GetPercentile(double aPercent) const
+{
+    assert(0.0 <= aPercent);
+    assert(100.0 >= aPercent);
+
+    if (0.0 >= mTotal)
+    {
+        return 0.0;
+    }
+
+    auto   lRank   = aPercent * mTotal / 100.0;
+    double lWeight = 0.0;
+
+    for (unsigned int i = 0; i < STATS_BUCKET_QTY; i++)
+    {
+        if (0.0 < mBuckets[i])
+        {
+            lWeight += mBuckets[i];
+            if (lRank <= lWeight)
+            {
+                return Stats::GetMiddle(i);
+            }
+        }
+    }
+
+    // The rounding of the sum may leave lRank a little above lWeight for
+    // 100.0.
+    for (unsigned int i = STATS_BUCKET_QTY; 0 < i; i--)
+    {
+        if (0.0 < mBuckets[i - 1])
+        {
+            return Stats::GetMiddle(i - 1);
+        }
+    }
+
+    return 0.0;
+}
+
+void StatsDecay::AddSample(uint64_t aNow, double aValue)
+{
+    if (0.0 >= mTotal)
+    {
+        mLandmark = aNow;
+    }
+
+    auto lAge_tau = (mLandmark < aNow) ? (static_cast<double>(aNow - mLandmark) / mTau) : 0.0;
+
+    if (RESCALE_TAU < lAge_tau)
+    {
+        auto lFactor = exp(-lAge_tau);
+
+        for (unsigned int i = 0; i < STATS_BUCKET_QTY; i++)
+        {
+            mBuckets[i] *= lFactor;
+        }
+
+        mLandmark = aNow;
+        mSum     *= lFactor;
+        mTotal   *= lFactor;
+        lAge_tau  = 0.0;
+    }
+
+    mScale = exp(lAge_tau);
+
+    mBuckets[Stats::GetIndex(aValue)] += mScale;
+
+    mSum   += mScale * aValue;
+    mTotal += mScale;
+}
+
+void StatsDecay::Reset()
+{
+    memset(&mBuckets, 0, sizeof(mBuckets));
+
+    mLandmark = 0;
+    mScale    = 1.0;
+    mSum      = 0.0;
+    mTotal    = 0.0;
+}
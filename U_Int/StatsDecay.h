@@ -0,0 +1,63 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/StatsDecay.h
+
+#pragma once
+
+// ===== Local ==============================================================
+#include "Stats.h"
+
+// An exponentially decaying histogram. A sample weighs exp(-Age / Tau), so
+// the estimate follows the recent samples without a window to keep. The
+// decay uses a landmark: a new sample weighs exp((aNow - Landmark) / Tau),
+// the older ones keep their weight, which gives the same ratios without
+// touching the buckets at each sample. When the weights become too large,
+// they are all scaled down and the landmark moves to aNow.
+//
+// A single thread uses an instance.
+class StatsDecay
+{
+
+public:
+
+    // aTau  The time constant, in ticks. A sample aTau old weighs 1 / e of
+    //       a new one.
+    StatsDecay(uint64_t aTau);
+
+    // Return  The decayed average, in us
+    double GetAverage() const;
+
+    // Return  The decayed weight of all the samples, 1.0 for a new sample
+    double GetCount() const;
+
+    // O(buckets)
+    //
+    // aPercent  0.0 to 100.0
+    //
+    // Return  The middle of the bucket containing the value, in us
+    double GetPercentile(double aPercent) const;
+
+    // O(1), except when the weights are scaled down, O(buckets) once per
+    // RESCALE_TAU time constants.
+    //
+    // aNow    The time of the sample, in ticks. A sample a little older
+    //         than the previous one only weighs a little less.
+    // aValue  In us
+    void AddSample(uint64_t aNow, double aValue);
+
+    void Reset();
+
+private:
+
+    uint64_t mLandmark;
+    uint64_t mTau;
+
+    double mScale; // The weight of a new sample, 1.0 at the landmark
+    double mSum;   // Sum of the weighted values
+    double mTotal; // Sum of the weights
+
+    double mBuckets[STATS_BUCKET_QTY];
+
+};
@@ -0,0 +1,140 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/StatsShards.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "StatsShards.h"
+
+// Public
+// //////////////////////////////////////////////////////////////////////////
+
+StatsShards::StatsShards(unsigned int aQty) : mQty(aQty)
+{
+    assert(0 < aQty);
+
+    mShards = new Shard[aQty];
+}
+
+StatsShards::~StatsShards()
+{
+    assert(nullptr != mShards);
+
+    delete[] mShards;
+}
+
+void StatsShards::Get(Stats* aOut) const
+{
+    for (unsigned int i = 0; i < mQty; i++)
+    {
+        Get(i, aOut);
+    }
+}
+
+// The reader side of a sequence lock. The writer increments mSequence
+// before and after updating the published moments, so an odd or changed
+// value means the copy must be done again.
+void StatsShards::Get(unsigned int aShard, Stats* aOut) const
+{
+    assert(mQty > aShard);
+    assert(nullptr != aOut);
+
+    auto lS = mShards + aShard;
+
+    Stats::Moments lMoments;
+
+    uint64_t lBefore;
+    uint64_t lAfter;
+
+    do
+    {
+        lBefore = lS->mSequence.load(std::memory_order_acquire);
+
+        lMoments.mN    = lS->mN   .load(std::memory_order_relaxed);
+        lMoments.mM2   = lS->mM2  .load(std::memory_order_relaxed);
+        lMoments.mMax  = lS->mMax .load(std::memory_order_relaxed);
+        lMoments.mMean = lS->mMean.load(std::memory_order_relaxed);
+        lMoments.mMin  = lS->mMin .load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        lAfter = lS->mSequence.load(std::memory_order_relaxed);
+    }
+    while ((0 != (lBefore & 1)) || (lBefore != lAfter));
+
+    Stats::Moments_Merge(&aOut->mMoments, lMoments);
+
+    // The writer increments a bucket before publishing the moments, so the
+    // buckets read here contain at least the lMoments.mN samples.
+    for (unsigned int i = 0; i < STATS_BUCKET_QTY; i++)
+    {
+        aOut->mBuckets[i] += lS->mBuckets[i].load(std::memory_order_relaxed);
+    }
+}
+
+unsigned int StatsShards::GetQty() const { return mQty; }
+
+void StatsShards::AddSample(unsigned int aShard, double aValue)
+{
+    assert(mQty > aShard);
+
+    auto lS = mShards + aShard;
+
+    // Single writer, a load and a store are enough.
+    auto& lBucket = lS->mBuckets[Stats::GetIndex(aValue)];
+
+    lBucket.store(lBucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    Stats::Moments_Add(&lS->mWriter, aValue);
+
+    auto lSequence = lS->mSequence.load(std::memory_order_relaxed);
+
+    lS->mSequence.store(lSequence + 1, std::memory_order_relaxed);
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    lS->mN   .store(lS->mWriter.mN   , std::memory_order_relaxed);
+    lS->mM2  .store(lS->mWriter.mM2  , std::memory_order_relaxed);
+    lS->mMax .store(lS->mWriter.mMax , std::memory_order_relaxed);
+    lS->mMean.store(lS->mWriter.mMean, std::memory_order_relaxed);
+    lS->mMin .store(lS->mWriter.mMin , std::memory_order_relaxed);
+
+    lS->mSequence.store(lSequence + 2, std::memory_order_release);
+}
+
+void StatsShards::Reset()
+{
+    for (unsigned int i = 0; i < mQty; i++)
+    {
+        mShards[i].Reset();
+    }
+}
+
+// Private
+// //////////////////////////////////////////////////////////////////////////
+
+StatsShards::Shard::Shard()
+{
+    Reset();
+}
+
+void StatsShards::Shard::Reset()
+{
+    memset(&mWriter, 0, sizeof(mWriter));
+
+    mSequence = 0;
+
+    mN    = 0;
+    mM2   = 0.0;
+    mMax  = 0.0;
+    mMean = 0.0;
+    mMin  = 0.0;
+
+    for (auto& lBucket : mBuckets)
+    {
+        lBucket = 0;
+    }
+}
@@ -0,0 +1,83 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/StatsShards.h
+
+#pragma once
+
+// ===== Local ==============================================================
+#include "Stats.h"
+
+// Statistics split in shards, each written by a single thread. A reader
+// merges them at any time, without lock and without stopping the writers.
+//
+// The moments of a shard are published under a sequence counter, so a
+// reader always sees a consistent count, mean and variance. The buckets
+// are read after them, so a snapshot taken during a run may count a few
+// more samples in its histogram than in its moments, never less.
+class StatsShards
+{
+
+public:
+
+    // aQty  The count of shards, usually one per writer thread
+    StatsShards(unsigned int aQty);
+
+    ~StatsShards();
+
+    // Merge all the shards
+    //
+    // aOut [---;RW-] The samples are added to this instance
+    void Get(Stats* aOut) const;
+
+    // Copy one shard
+    //
+    // aOut [---;RW-] The samples are added to this instance
+    void Get(unsigned int aShard, Stats* aOut) const;
+
+    unsigned int GetQty() const;
+
+    // Writer of the shard, O(1), without allocation or lock
+    void AddSample(unsigned int aShard, double aValue);
+
+    // No writer must be running
+    void Reset();
+
+private:
+
+    // Each shard starts on its own cache line, so the writers do not share
+    // a modified line.
+    class alignas(64) Shard
+    {
+
+    public:
+
+        Shard();
+
+        void Reset();
+
+        // Only the writer accesses it
+        Stats::Moments mWriter;
+
+        // Odd while the writer updates the published moments
+        std::atomic<uint64_t> mSequence;
+
+        std::atomic<uint64_t> mN;
+        std::atomic<double>   mM2;
+        std::atomic<double>   mMax;
+        std::atomic<double>   mMean;
+        std::atomic<double>   mMin;
+
+        std::atomic<uint64_t> mBuckets[STATS_BUCKET_QTY];
+
+    };
+
+    StatsShards(const StatsShards&);
+
+    const StatsShards& operator = (const StatsShards&);
+
+    unsigned int mQty;
+    Shard      * mShards;
+
+};
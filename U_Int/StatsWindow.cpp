@@ -0,0 +1,134 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/StatsWindow.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "StatsWindow.h"
+
+// Public
+// //////////////////////////////////////////////////////////////////////////
+
+StatsWindow::StatsWindow(unsigned int aQty, uint64_t aInterval) : mInterval(aInterval), mNumber(0), mQty(aQty)
+{
+    assert(0 < aQty);
+    assert(0 < aInterval);
+
+    mStats = new Stats[aQty];
+
+    memset(&mBuckets, 0, sizeof(mBuckets));
+}
+
+StatsWindow::~StatsWindow()
+{
+    assert(nullptr != mStats);
+
+    delete[] mStats;
+}
+
+// The intervals AddSample did not clear yet, because no sample came since
+// aNow, are removed from the copy of the sum.
+void StatsWindow::Get(uint64_t aNow, Stats* aOut) const
+{
+    assert(nullptr != aOut);
+
+    auto lNumber = aNow / mInterval;
+    auto lStale  = (mNumber < lNumber) ? (lNumber - mNumber) : 0;
+    if (mQty <= lStale)
+    {
+        return;
+    }
+
+    uint64_t lBuckets[STATS_BUCKET_QTY];
+
+    memcpy(&lBuckets, &mBuckets, sizeof(lBuckets));
+
+    for (unsigned int i = 0; i < mQty; i++)
+    {
+        // The interval of mNumber - i
+        auto lIn = mStats + ((mNumber + mQty - i) % mQty);
+
+        if (mQty - lStale <= i)
+        {
+            for (unsigned int b = 0; b < STATS_BUCKET_QTY; b++)
+            {
+                lBuckets[b] -= lIn->mBuckets[b];
+            }
+        }
+        else
+        {
+            Stats::Moments_Merge(&aOut->mMoments, lIn->mMoments);
+        }
+    }
+
+    for (unsigned int b = 0; b < STATS_BUCKET_QTY; b++)
+    {
+        aOut->mBuckets[b] += lBuckets[b];
+    }
+}
+
+void StatsWindow::AddSample(uint64_t aNow, double aValue)
+{
+    auto lNumber = aNow / mInterval;
+    if (mNumber < lNumber)
+    {
+        Advance(lNumber);
+    }
+
+    auto lStats = mStats + (mNumber % mQty);
+
+    Stats::Moments_Add(&lStats->mMoments, aValue);
+
+    auto lIndex = Stats::GetIndex(aValue);
+
+    lStats->mBuckets[lIndex]++;
+    mBuckets        [lIndex]++;
+}
+
+void StatsWindow::Reset()
+{
+    for (unsigned int i = 0; i < mQty; i++)
+    {
+        mStats[i] = Stats();
+    }
+
+    memset(&mBuckets, 0, sizeof(mBuckets));
+
+    mNumber = 0;
+}
+
+// Private
+// //////////////////////////////////////////////////////////////////////////
+
+void StatsWindow::Advance(uint64_t aNumber)
+{
+    assert(mNumber < aNumber);
+
+    // After a pause longer than the window, all the intervals are cleared
+    // once.
+    auto lQty = aNumber - mNumber;
+    if (mQty < lQty)
+    {
+        lQty = mQty;
+    }
+
+    for (unsigned int i = 1; i <= lQty; i++)
+    {
+        auto lStats = mStats + ((aNumber - lQty + i) % mQty);
+
+        if (0 < lStats->mMoments.mN)
+        {
+            for (unsigned int b = 0; b < STATS_BUCKET_QTY; b++)
+            {
+                mBuckets[b] -= lStats->mBuckets[b];
+            }
+
+            *lStats = Stats();
+        }
+    }
+
+    mNumber = aNumber;
+}
@@ -0,0 +1,70 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/StatsWindow.h
+
+#pragma once
+
+// ===== Local ==============================================================
+#include "Stats.h"
+
+// The statistics of the samples of the last intervals, for a monitoring
+// running longer than the memory of a Stats. A ring keeps one Stats per
+// interval and the sum of their histograms. When the time moves to a new
+// interval, the oldest one leaves the sum and is cleared, so a percentile
+// over the window costs O(buckets) whatever the sample count, and the
+// memory does not grow.
+//
+// A single thread uses an instance.
+class StatsWindow
+{
+
+public:
+
+    // aQty       The count of intervals in the window
+    // aInterval  The duration of an interval, in ticks
+    StatsWindow(unsigned int aQty, uint64_t aInterval);
+
+    ~StatsWindow();
+
+    // The samples of the aQty intervals ending with the one containing
+    // aNow. The interval of aNow is only partly elapsed, so the window
+    // covers between aQty - 1 and aQty intervals.
+    //
+    // aNow      In ticks
+    // aOut [---;RW-] The samples are added to this instance
+    void Get(uint64_t aNow, Stats* aOut) const;
+
+    // O(1), except when the sample starts a new interval, O(buckets) per
+    // interval to clear.
+    //
+    // aNow    The time of the sample, in ticks. A sample older than the
+    //         interval of the previous one goes in this interval.
+    // aValue  In us
+    void AddSample(uint64_t aNow, double aValue);
+
+    void Reset();
+
+private:
+
+    StatsWindow(const StatsWindow&);
+
+    const StatsWindow& operator = (const StatsWindow&);
+
+    // Clear the intervals leaving the window before the one of aNumber
+    void Advance(uint64_t aNumber);
+
+    uint64_t mInterval;
+
+    // The interval of the last sample, aNow / mInterval. mStats[mNumber %
+    // mQty] receives the samples.
+    uint64_t mNumber;
+
+    unsigned int mQty;
+    Stats      * mStats;
+
+    // The sum of the histograms of mStats
+    uint64_t mBuckets[STATS_BUCKET_QTY];
+
+};
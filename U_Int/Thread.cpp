@@ -0,0 +1,62 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/Thread.cpp
+
+#include "Component.h"
+
+#ifdef _KMS_LINUX_
+    // ===== System =========================================================
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+// ===== Local ==============================================================
+#include "Thread.h"
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+bool Thread_SetAffinity(unsigned int aCpu)
+{
+    #ifdef _KMS_LINUX_
+        if (CPU_SETSIZE <= aCpu)
+        {
+            return false;
+        }
+
+        cpu_set_t lSet;
+
+        CPU_ZERO(&lSet);
+        CPU_SET(aCpu, &lSet);
+
+        return 0 == pthread_setaffinity_np(pthread_self(), sizeof(lSet), &lSet);
+    #endif
+
+    #ifdef _KMS_WINDOWS_
+        if (64 <= aCpu)
+        {
+            return false;
+        }
+
+        return 0 != SetThreadAffinityMask(GetCurrentThread(), 1ULL << aCpu);
+    #endif
+}
+
+bool Thread_SetPriority(unsigned int aPriority)
+{
+    #ifdef _KMS_LINUX_
+        struct sched_param lParam;
+
+        memset(&lParam, 0, sizeof(lParam));
+
+        lParam.sched_priority = aPriority;
+
+        return 0 == pthread_setschedparam(pthread_self(), (0 == aPriority) ? SCHED_OTHER : SCHED_FIFO, &lParam);
+    #endif
+
+    #ifdef _KMS_WINDOWS_
+        return FALSE != SetThreadPriority(GetCurrentThread(), (0 == aPriority) ? THREAD_PRIORITY_NORMAL : THREAD_PRIORITY_TIME_CRITICAL);
+    #endif
+}
@@ -0,0 +1,28 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/Thread.h
+
+#pragma once
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+// Leave the affinity or the priority as it is
+#define THREAD_KEEP (0xffffffff)
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+// Run the calling thread only on this core
+//
+// Return  false if the OS refused
+extern bool Thread_SetAffinity(unsigned int aCpu);
+
+// aPriority  0 for the normal time sharing class or the SCHED_FIFO
+//            priority, 1 to 99. On Windows, any priority other than 0
+//            means THREAD_PRIORITY_TIME_CRITICAL.
+//
+// Return  false if the OS refused, usually because of missing privileges
+extern bool Thread_SetPriority(unsigned int aPriority);
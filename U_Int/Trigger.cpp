@@ -0,0 +1,302 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/Trigger.cpp
+
+// Intel 82576EB Gigabit Ethernet Controller Datasheet
+// https://www.intel.com/content/dam/www/public/us/en/documents/datasheets/82576eg-gbe-datasheet.pdf
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "Thread.h"
+#include "Trigger.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+// Intel 82576 registers
+#define REG_ICR (0x1500 / sizeof(uint32_t)) // Interrupt Cause Read
+#define REG_ICS (0x1504 / sizeof(uint32_t)) // Interrupt Cause Set
+
+// Variables
+// //////////////////////////////////////////////////////////////////////////
+
+static std::atomic<unsigned int> sInterruptCounts[VECTOR_QTY_MAX];
+
+// Only the trigger thread writes them
+static unsigned int sTriggerCounts[VECTOR_QTY_MAX];
+
+// The iteration of the last trigger of each vector
+static std::atomic<unsigned int> sIterations[VECTOR_QTY_MAX];
+
+static std::atomic<uint64_t>     sCallbacks;
+static std::atomic<uint64_t>     sCollided;
+static std::atomic<unsigned int> sConcurrency;
+static std::atomic<unsigned int> sConcurrencyMax;
+static std::atomic<uint64_t>     sMerged;
+static std::atomic<uint64_t>     sOverlapped;
+
+// Trigger_SetCallbackPlacement writes sPlaceCpu and sPlacePriority, then
+// increments sPlaceGeneration.
+static std::atomic<unsigned int> sPlaceGeneration;
+static unsigned int              sPlaceCpu;
+static unsigned int              sPlacePriority;
+static std::atomic<unsigned int> sPlaced;
+static std::atomic<unsigned int> sPlaceFailed;
+
+// The poller thread reads ICR, Trigger_Fire must not clear it
+static bool sPolling;
+
+// The generation of the placement of the calling thread
+static thread_local unsigned int sThreadGeneration;
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static void Place(unsigned int aGeneration);
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+bool Trigger_Fire(DrvDMA* aDD, volatile uint32_t* aReg, uint64_t aMask, unsigned int aIteration, Capture* aCapture)
+{
+    assert(nullptr != aDD);
+    assert(0 != aMask);
+    assert(nullptr != aCapture);
+
+    Sample lSample;
+
+    auto lRet = DrvDMA_OK;
+    auto lVectorQty = aCapture->GetVectorQty();
+
+    if ((nullptr != aReg) && !sPolling)
+    {
+        // Reading ICR clears the cause of the previous interrupt.
+        auto lDummy = aReg[REG_ICR];
+        (void)lDummy;
+    }
+
+    lSample.BeforeTrig(aIteration);
+
+    // Published after BeforeTrig, so an interrupt attributed to this
+    // trigger never looks older than it.
+    for (unsigned int v = 0; v < lVectorQty; v++)
+    {
+        if (0 != (aMask & (1ULL << v)))
+        {
+            sIterations[v].store(aIteration, std::memory_order_release);
+
+            sTriggerCounts[v]++;
+        }
+    }
+
+    if (nullptr != aReg)
+    {
+        aReg[REG_ICS] = static_cast<uint32_t>(aMask);
+    }
+    else
+    {
+        lRet = aDD->Interrupt_Simulate(aMask);
+    }
+
+    lSample.AfterTrig();
+
+    for (unsigned int v = 0; v < lVectorQty; v++)
+    {
+        if (0 != (aMask & (1ULL << v)))
+        {
+            lSample.SetId(v, aIteration);
+
+            aCapture->OnTrigger(lSample);
+        }
+    }
+
+    if (DrvDMA_OK != lRet)
+    {
+        std::cout << "ERROR  DrvDMA::Interrupt_Simulate  failed - " << lRet << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+void Trigger_GetCallbackStats(Trigger_CallbackStats* aOut)
+{
+    assert(nullptr != aOut);
+
+    aOut->mCallbacks      = sCallbacks;
+    aOut->mCollided       = sCollided;
+    aOut->mConcurrencyMax = sConcurrencyMax;
+    aOut->mMerged         = sMerged;
+    aOut->mOverlapped     = sOverlapped;
+    aOut->mPlaced         = sPlaced;
+    aOut->mPlaceFailed    = sPlaceFailed;
+}
+
+unsigned int Trigger_GetInterruptCount(unsigned int aVector)
+{
+    assert(VECTOR_QTY_MAX > aVector);
+
+    return sInterruptCounts[aVector];
+}
+
+unsigned int Trigger_GetTriggerCount(unsigned int aVector)
+{
+    assert(VECTOR_QTY_MAX > aVector);
+
+    return sTriggerCounts[aVector];
+}
+
+uint64_t Trigger_GetMask(const Options& aOptions, unsigned int aIteration)
+{
+    if (VECTOR_MODE_ROUND_ROBIN == aOptions.mVectorMode)
+    {
+        return 1ULL << (aIteration % aOptions.mVectorQty);
+    }
+
+    return Trigger_GetRegisterMask(aOptions);
+}
+
+uint64_t Trigger_GetRegisterMask(const Options& aOptions)
+{
+    assert(0 < aOptions.mVectorQty);
+    assert(VECTOR_QTY_MAX >= aOptions.mVectorQty);
+
+    return (1ULL << aOptions.mVectorQty) - 1;
+}
+
+void Trigger_SetCallbackPlacement(unsigned int aCpu, unsigned int aPriority)
+{
+    sPlaceCpu      = aCpu;
+    sPlacePriority = aPriority;
+
+    sPlaceGeneration.fetch_add(1, std::memory_order_release);
+}
+
+void Trigger_SetPolling(bool aPolling)
+{
+    sPolling = aPolling;
+}
+
+void Trigger_Reset()
+{
+    for (unsigned int v = 0; v < VECTOR_QTY_MAX; v++)
+    {
+        sInterruptCounts[v] = 0;
+        sIterations     [v] = SAMPLE_ITERATION_NONE;
+        sTriggerCounts  [v] = 0;
+    }
+
+    sCallbacks      = 0;
+    sCollided       = 0;
+    sConcurrencyMax = 0;
+    sMerged         = 0;
+    sOverlapped     = 0;
+    sPlaced         = 0;
+    sPlaceFailed    = 0;
+}
+
+void Trigger_OnInterrupt(void* aContext, uint64_t aInterrupts)
+{
+    assert(nullptr != aContext);
+
+    Sample lSample;
+
+    // Time stamp first, the rest is not part of the measure.
+    lSample.OnInterrupt(aInterrupts);
+
+    Trigger_OnNotification(reinterpret_cast<Capture*>(aContext), &lSample, aInterrupts);
+}
+
+void Trigger_OnNotification(Capture* aCapture, Sample* aSample, uint64_t aInterrupts)
+{
+    assert(nullptr != aCapture);
+    assert(nullptr != aSample);
+
+    auto lGeneration = sPlaceGeneration.load(std::memory_order_acquire);
+    if (sThreadGeneration != lGeneration)
+    {
+        Place(lGeneration);
+    }
+
+    auto lConcurrency = sConcurrency.fetch_add(1) + 1;
+    if (1 < lConcurrency)
+    {
+        sOverlapped++;
+    }
+
+    auto lMax = sConcurrencyMax.load();
+    while ((lMax < lConcurrency) && !sConcurrencyMax.compare_exchange_weak(lMax, lConcurrency))
+    {
+    }
+
+    auto lVectorQty = aCapture->GetVectorQty();
+    auto lMask      = (1ULL << lVectorQty) - 1;
+
+    // When the callback does not report a registered vector, count it for
+    // the vector 0, as a single vector test always did.
+    auto lBits = aInterrupts & lMask;
+    if (0 == lBits)
+    {
+        lBits = 1;
+    }
+
+    unsigned int lCount = 0;
+
+    for (unsigned int v = 0; v < lVectorQty; v++)
+    {
+        if (0 != (lBits & (1ULL << v)))
+        {
+            aSample->SetId(v, sIterations[v].load(std::memory_order_acquire));
+
+            sInterruptCounts[v]++;
+
+            if (!aCapture->OnInterrupt(*aSample))
+            {
+                sCollided++;
+            }
+
+            lCount++;
+        }
+    }
+
+    sCallbacks++;
+
+    if (1 < lCount)
+    {
+        sMerged++;
+    }
+
+    sConcurrency--;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+void Place(unsigned int aGeneration)
+{
+    sThreadGeneration = aGeneration;
+
+    bool lOK = true;
+
+    if ((THREAD_KEEP != sPlaceCpu) && !Thread_SetAffinity(sPlaceCpu))
+    {
+        lOK = false;
+    }
+
+    if ((THREAD_KEEP != sPlacePriority) && !Thread_SetPriority(sPlacePriority))
+    {
+        lOK = false;
+    }
+
+    if (lOK)
+    {
+        sPlaced++;
+    }
+    else
+    {
+        sPlaceFailed++;
+    }
+}
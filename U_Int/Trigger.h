@@ -0,0 +1,93 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_Int/Trigger.h
+
+#pragma once
+
+// ===== DrvDMA =============================================================
+#include <DrvDMA_U.h>
+
+// ===== Local ==============================================================
+#include "Capture.h"
+
+// Data types
+// //////////////////////////////////////////////////////////////////////////
+
+// With the blocked and poll delivery models, a callback is a wake up of
+// the waiter thread or a cause the poller thread read.
+typedef struct
+{
+    uint64_t mCallbacks;
+
+    // Callbacks receiving more than one of the registered vectors
+    uint64_t mMerged;
+
+    // Callbacks starting while another one was running
+    uint64_t mOverlapped;
+
+    // Samples dropped because an overlapping callback was pushing the
+    // same vector, see Capture::OnInterrupt
+    uint64_t mCollided;
+
+    // The largest count of callbacks running at the same time
+    unsigned int mConcurrencyMax;
+
+    // The count of callback threads Trigger_SetCallbackPlacement changed
+    // and the count of failures
+    unsigned int mPlaced;
+    unsigned int mPlaceFailed;
+}
+Trigger_CallbackStats;
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+// aReg        The 82576 registers, nullptr for the sim trigger
+// aMask       The vectors to trigger, see Trigger_GetMask
+// aIteration  The iteration, increasing
+//
+// Return  false if DrvDMA::Interrupt_Simulate failed
+extern bool Trigger_Fire(DrvDMA* aDD, volatile uint32_t* aReg, uint64_t aMask, unsigned int aIteration, Capture* aCapture);
+
+extern void Trigger_GetCallbackStats(Trigger_CallbackStats* aOut);
+
+// Return  The count of callbacks which received this vector
+extern unsigned int Trigger_GetInterruptCount(unsigned int aVector);
+
+// Return  The count of triggers of this vector
+extern unsigned int Trigger_GetTriggerCount(unsigned int aVector);
+
+// Return  All the vectors or, with --vector-mode=rr, one vector in turn
+extern uint64_t Trigger_GetMask(const Options& aOptions, unsigned int aIteration);
+
+// Return  The mask to pass to DrvDMA::Interrupt_Register
+extern uint64_t Trigger_GetRegisterMask(const Options& aOptions);
+
+// The callback applies this placement to its thread the first time it
+// runs on it after this call. It cannot place a thread before it calls
+// back, and a new thread for each callback makes the placement useless, so
+// see the mPlaced counter.
+//
+// aCpu       The core or THREAD_KEEP
+// aPriority  See Thread_SetPriority or THREAD_KEEP
+extern void Trigger_SetCallbackPlacement(unsigned int aCpu, unsigned int aPriority);
+
+// With the poll delivery model, the poller thread reads ICR and
+// Trigger_Fire must not clear it before the trigger.
+extern void Trigger_SetPolling(bool aPolling);
+
+// Clear the counters and forget the previous iterations. No interrupt
+// must be pending.
+extern void Trigger_Reset();
+
+// The callback to pass to DrvDMA::Interrupt_Register, with the Capture
+// instance as context
+extern void Trigger_OnInterrupt(void* aContext, uint64_t aInterrupts);
+
+// Route a notification to the vectors it carries. The callback, the waiter
+// and the poller threads call it after time stamping the sample.
+//
+// aSample [---;RW-] A sample Sample::OnInterrupt filled
+extern void Trigger_OnNotification(Capture* aCapture, Sample* aSample, uint64_t aInterrupts);
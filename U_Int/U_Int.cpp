@@ -1,4 +1,3 @@
-
 // Author    KMS - Martin Dubois, P. Eng.
 // Copyright (C) 2026 KMS
 // License   http://www.apache.org/licenses/LICENSE-2.0
@@ -8,60 +7,211 @@
 // Intel 82576EB Gigabit Ethernet Controller Datasheet
 // https://www.intel.com/content/dam/www/public/us/en/documents/datasheets/82576eg-gbe-datasheet.pdf
 
+// Usage  U_Int [Trigger] [--Option=Value] ...
+//
+// Triggers
+//  nic        Write the interrupt cause set register of the Intel 82576
+//             (default)
+//  sim        Call DrvDMA::Interrupt_Simulate, measure the delivery of the
+//             callback by the DrvDMA stack without the NIC
+//
+// Options
+//  --bench-stats        Compare Stats::AddSample and Stats::AddSamples on
+//                       10 ^ 8 samples, without driver
+//  --callback-cpu=N[,N...]
+//                       Run the callback thread, or the waiter or poller
+//                       thread of --delivery, on this core. The callback
+//                       moves its own thread the first time it runs on it,
+//                       so it only works when DrvDMA calls back from a
+//                       long lived thread. The report displays the count of
+//                       placed threads.
+//  --callback-fifo=P[,P...]
+//                       SCHED_FIFO priority of the callback thread, 1 to
+//                       99, 0 meaning the normal class. On Windows, any
+//                       value other than 0 means time critical.
+//  --clock=C            os or tsc, time stamp counter. tsc uses rdtscp,
+//                       calibrated against the os clock at start-up (os)
+//  --delivery=D[,D...]  callback, blocked or poll, how the test receives
+//                       the interrupts. callback is the DrvDMA callback.
+//                       blocked is a thread blocked on a condition
+//                       variable the callback signals, DrvDMA having no
+//                       blocking wait. poll is a thread spinning on the ICR
+//                       register of the NIC, with the interrupts masked,
+//                       and needs the nic trigger. With more than one
+//                       model, the report compares them (callback)
+//  --device=N           Index of the driver instance (0)
+//  --format=F           text or binary, format of the samples written to
+//                       --output, see CaptureFile.h (text)
+//  --histogram          Display the non empty buckets of the histograms
+//  --input=File         Analyze a binary capture instead of running a test
+//                       and, with --output, convert it to text
+//  --iteration=N        Interrupt count (1000)
+//  --load=L[,L...]      cpu, mem or sys. Run the test without load, then
+//                       with each load in background and compare the
+//                       distributions. cpu spins on integer arithmetic,
+//                       mem copies a 64 MiB buffer and sys calls
+//                       sched_yield or SwitchToThread in a loop. In storm
+//                       mode, each load displays its own table.
+//  --load-cpus=N[,N...] Run one load thread on each of these cores (one
+//                       thread, not pinned)
+//  --output=File        Write the samples to this file (stdout)
+//  --period-ms=N        Delay between two interrupts (100)
+//  --rate=R[,R...]      Run a storm step at each rate, in Hz, 0 meaning as
+//                       fast as possible, --iteration interrupts per step
+//                       and report the delivered rate, the lost interrupts
+//                       and the latency percentiles of each step
+//  --trigger-cpu=N[,N...]
+//                       Run the trigger thread on this core
+//  --trigger-fifo=P[,P...]
+//                       SCHED_FIFO priority of the trigger thread, see
+//                       --callback-fifo
+//
+//  With more than one value in the --callback-... and --trigger-...
+//  options, the test runs for each combination and, in period mode, the
+//  report compares them. Changing the priority usually needs privileges,
+//  a refused placement displays a warning and the test runs anyway.
+//
+//  --vector-mode=M      all or rr, round robin, the vectors to trigger at
+//                       each iteration (all)
+//  --vectors=N          Vector count, 1 to 8. Vector v is the bit v of the
+//                       interrupt mask and of the ICS register. The report
+//                       displays the statistics of each vector and the
+//                       overlap of the callbacks (1)
+//  --window-s=N         Also keep the user time of the last N seconds,
+//                       using the time stamps of the samples, and a
+//                       decaying estimate with a time constant of N
+//                       seconds. The live display and the report show their
+//                       p99. With --input, the window is the end of the
+//                       capture. (0, no window)
+
 #include "Component.h"
 
+// ===== C++ ================================================================
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
 // ===== DrvDMA =============================================================
 #include <DrvDMA_U.h>
 
 // ===== Local ==============================================================
-#include "Sample.h"
-#include "Stats.h"
+#include "Analyze.h"
+#include "Bench.h"
+#include "Capture.h"
+#include "Clock.h"
+#include "Delivery.h"
+#include "Load.h"
+#include "Options.h"
+#include "Report.h"
+#include "Thread.h"
+#include "Trigger.h"
 
 // Constants
 // //////////////////////////////////////////////////////////////////////////
 
-static constexpr uint64_t INT_MASK = 1;
+#define DEFAULT_DEVICE     (0)
+#define DEFAULT_ITERATION  (1000)
+#define DEFAULT_PERIOD_ms  (100)
+#define DEFAULT_VECTOR_QTY (1)
 
-static constexpr unsigned int ITERATION = 1000;
+#define DRAIN_ms    (100)
+#define PROGRESS_ms (1000)
 
-static constexpr unsigned int PERIOD_ms = 100;
+// Let the load threads start and allocate their memory
+#define LOAD_WARM_UP_ms (100)
 
-static constexpr auto SIMULATE = false;
+// Data types
+// //////////////////////////////////////////////////////////////////////////
 
-static constexpr auto TRIG_MAX_us = 20;
+// The name and the statistics of each run
+typedef struct
+{
+    std::vector<std::string> mNames;
+    std::vector<Stats>       mTrigs;
+    std::vector<Stats>       mUsers;
+}
+Results;
 
-// Variables
+// Static function declarations
 // //////////////////////////////////////////////////////////////////////////
 
-uint64_t gFrequency;
+static unsigned int CountBits(unsigned int aIn);
 
-static Sample sSamples[ITERATION];
+static bool Options_Parse(Options* aOptions, int aCount, const char** aVector);
 
-static volatile unsigned int sInterruptCount = 0;
+static bool ParseDeliveries(const char* aIn, Options* aOptions);
+static bool ParseList      (const char* aIn, unsigned int* aOut, unsigned int* aQty, unsigned int aMax);
+static bool ParseLoads     (const char* aIn, Options* aOptions);
+static bool ParseNames     (const char* aIn, const char** aNames, unsigned int aQty, unsigned int* aOut);
 
-// Static function declarations
-// //////////////////////////////////////////////////////////////////////////
+static bool ParsePlacement(const char* aIn, Placement* aOut);
 
-// ===== Entry point ========================================================
+static bool ParseUInt(const char* aIn, unsigned int* aOut);
 
-static void OnInterrupt(void* aContext, uint64_t aInterrupts);
+static std::string  Placement_Apply   (const Options& aOptions, unsigned int aIndex);
+static unsigned int Placement_GetQty  (const Placement& aIn);
+static unsigned int Placement_GetValue(const Placement& aIn, unsigned int* aIndex);
 
-// Configurations
-// //////////////////////////////////////////////////////////////////////////
+static int Period(DrvDMA* aDD, volatile uint32_t* aReg, const Options& aOptions, Capture* aCapture);
+static int Storm (DrvDMA* aDD, volatile uint32_t* aReg, const Options& aOptions, Capture* aCapture);
+
+static void Period_Display(const Options& aOptions, const Capture& aCapture);
 
-#define DEVICE_INDEX (0)
+static int Run     (DrvDMA* aDD, volatile uint32_t* aReg, const Options& aOptions, Capture* aCapture);
+static int RunLoads(DrvDMA* aDD, volatile uint32_t* aReg, const Options& aOptions, Capture* aCapture, const std::string& aName, bool aHeader, Results* aResults);
+static int Test    (DrvDMA* aDD, volatile uint32_t* aReg, const Options& aOptions, Capture* aCapture);
 
-int main()
+// Entry point
+// //////////////////////////////////////////////////////////////////////////
+
+int main(int aCount, const char** aVector)
 {
-    int lResult = __LINE__;
+    Options lOptions;
 
-    Stats lTrig;
-    Stats lUser;
+    if (!Options_Parse(&lOptions, aCount, aVector))
+    {
+        std::cout << "USAGE  U_Int [nic|sim] [--Option=Value] ..." << std::endl;
+        return __LINE__;
+    }
 
-    auto lRetB = QueryPerformanceFrequency(reinterpret_cast<LARGE_INTEGER*>(&gFrequency));
-    assert(lRetB);
+    if (nullptr != lOptions.mInput)
+    {
+        return Analyze(lOptions);
+    }
 
-    std::cout << "Performance counter frequency : " << gFrequency << " Hz" << std::endl;
+    if (!Clock_Init(lOptions.mClockSource))
+    {
+        std::cout << "ERROR  The TSC is not invariant or rdtscp is not supported" << std::endl;
+        return __LINE__;
+    }
+
+    if (lOptions.mBenchStats)
+    {
+        return Bench_Stats();
+    }
+
+    std::ofstream lFile;
+
+    if (nullptr != lOptions.mOutput)
+    {
+        lFile.open(lOptions.mOutput, (FORMAT_BINARY == lOptions.mFormat) ? (std::ios::out | std::ios::binary) : std::ios::out);
+        if (!lFile.is_open())
+        {
+            std::cout << "ERROR  Cannot open " << lOptions.mOutput << std::endl;
+            return __LINE__;
+        }
+    }
+
+    Capture lCapture(lFile.is_open() ? static_cast<std::ostream&>(lFile) : std::cout, lOptions.mFormat, Clock_GetFrequency(), lOptions.mVectorQty);
+
+    lCapture.SetWindow(lOptions.mWindow_s);
+
+    int lResult = __LINE__;
+
+    std::cout << "Performance counter frequency : " << Clock_GetFrequency() << " Hz" << std::endl;
+    std::cout << "Time stamp overhead           : " << Clock_GetOverhead() << " ticks" << std::endl;
 
     auto lDD = DrvDMA::Create();
     if (nullptr == lDD)
@@ -70,7 +220,7 @@ int main()
         return __LINE__;
     }
 
-    auto lRet = lDD->Connect(DEVICE_INDEX);
+    auto lRet = lDD->Connect(lOptions.mDevice);
     if (DrvDMA_OK != lRet)
     {
         std::cout << "ERROR  DrvDMA::Connect  failed - " << lRet << std::endl;
@@ -80,135 +230,682 @@ int main()
 
     std::cout << "Connected" << std::endl;
 
-    volatile void* lBAR0;
-    
-    lBAR0 = lDD->Memory_GetAddress(0);
-    if (nullptr == lBAR0)
+    volatile uint32_t* lReg;
+
+    lReg = nullptr;
+
+    // The sim trigger does not touch the device registers, so any device
+    // the driver controls can be used.
+    if (TRIGGER_NIC == lOptions.mTrigger)
     {
-        std::cout << "ERROR  DrvDMA::Memory_GetAddress  failed" << std::endl;
-        lResult = __LINE__;
-        goto End1;
+        volatile void* lBAR0;
+
+        lBAR0 = lDD->Memory_GetAddress(0);
+        if (nullptr == lBAR0)
+        {
+            std::cout << "ERROR  DrvDMA::Memory_GetAddress  failed" << std::endl;
+            lResult = __LINE__;
+            goto End1;
+        }
+
+        unsigned int lBAR0_Size_byte;
+
+        lBAR0_Size_byte = lDD->Memory_GetSize(0);
+        if ((128 * 1024) > lBAR0_Size_byte)
+        {
+            std::cout << "ERROR  The BAR0 is smaller than expected (" << lBAR0_Size_byte << " bytes)" << std::endl;
+            lResult = __LINE__;
+            goto End1;
+        }
+
+        lReg = reinterpret_cast<volatile uint32_t*>(lBAR0);
     }
 
-    unsigned int lBAR0_Size_byte;
-    
-    lBAR0_Size_byte = lDD->Memory_GetSize(0);
-    if ((128 * 1024) > lBAR0_Size_byte)
+    Trigger_Reset();
+
+    lResult = Run(lDD, lReg, lOptions, &lCapture);
+
+End1:
+    lRet = lDD->Disconnect();
+    assert(DrvDMA_OK == lRet);
+
+    std::cout << "Disconnected" << std::endl;
+
+End0:
+    lDD->Delete();
+
+    return lResult;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+unsigned int CountBits(unsigned int aIn)
+{
+    unsigned int lResult = 0;
+
+    for (unsigned int lBits = aIn; 0 != lBits; lBits &= lBits - 1)
     {
-        std::cout << "ERROR  The BAR0 is smaller than expected (" << lBAR0_Size_byte << " bytes)" << std::endl;
-        lResult = __LINE__;
-        goto End1;
+        lResult++;
     }
 
-    lRet = lDD->Interrupt_Register(INT_MASK, 0, OnInterrupt, nullptr);
-    if (DrvDMA_OK != lRet)
+    return lResult;
+}
+
+bool Options_Parse(Options* aOptions, int aCount, const char** aVector)
+{
+    memset(aOptions, 0, sizeof(*aOptions));
+
+    aOptions->mClockSource = CLOCK_SOURCE_OS;
+    aOptions->mDeliveries  = 1 << DELIVERY_CALLBACK;
+    aOptions->mDevice      = DEFAULT_DEVICE;
+    aOptions->mFormat      = FORMAT_TEXT;
+    aOptions->mIteration   = DEFAULT_ITERATION;
+    aOptions->mPeriod_ms   = DEFAULT_PERIOD_ms;
+    aOptions->mTrigger     = TRIGGER_NIC;
+    aOptions->mVectorMode  = VECTOR_MODE_ALL;
+    aOptions->mVectorQty   = DEFAULT_VECTOR_QTY;
+
+    for (int i = 1; i < aCount; i++)
     {
-        std::cout << "ERROR  DrvDMA::Interrupt_Register  failed - " << lRet << std::endl;
-        lResult = __LINE__;
-        goto End1;
+        auto lArg = aVector[i];
+        bool lOK  = true;
+
+        if      (0 == strcmp("nic", lArg)) { aOptions->mTrigger = TRIGGER_NIC; }
+        else if (0 == strcmp("sim", lArg)) { aOptions->mTrigger = TRIGGER_SIMULATE; }
+        else if (0 == strcmp("--clock=os"     , lArg)) { aOptions->mClockSource = CLOCK_SOURCE_OS; }
+        else if (0 == strcmp("--clock=tsc"    , lArg)) { aOptions->mClockSource = CLOCK_SOURCE_TSC; }
+        else if (0 == strcmp("--format=binary", lArg)) { aOptions->mFormat = FORMAT_BINARY; }
+        else if (0 == strcmp("--format=text"  , lArg)) { aOptions->mFormat = FORMAT_TEXT; }
+        else if (0 == strcmp("--bench-stats"  , lArg)) { aOptions->mBenchStats = true; }
+        else if (0 == strcmp("--histogram"    , lArg)) { aOptions->mHistogram = true; }
+        else if (0 == strcmp("--vector-mode=all", lArg)) { aOptions->mVectorMode = VECTOR_MODE_ALL; }
+        else if (0 == strcmp("--vector-mode=rr" , lArg)) { aOptions->mVectorMode = VECTOR_MODE_ROUND_ROBIN; }
+        else if (0 == strncmp("--callback-cpu=" , lArg, 15)) { lOK = ParsePlacement(lArg + 15, &aOptions->mCallbackCpus ); }
+        else if (0 == strncmp("--callback-fifo=", lArg, 16)) { lOK = ParsePlacement(lArg + 16, &aOptions->mCallbackFifos); }
+        else if (0 == strncmp("--trigger-cpu="  , lArg, 14)) { lOK = ParsePlacement(lArg + 14, &aOptions->mTriggerCpus  ); }
+        else if (0 == strncmp("--trigger-fifo=" , lArg, 15)) { lOK = ParsePlacement(lArg + 15, &aOptions->mTriggerFifos ); }
+        else if (0 == strncmp("--delivery=" , lArg, 11)) { lOK = ParseDeliveries(lArg + 11, aOptions); }
+        else if (0 == strncmp("--device="   , lArg,  9)) { lOK = ParseUInt(lArg +  9, &aOptions->mDevice); }
+        else if (0 == strncmp("--input="    , lArg,  8)) { aOptions->mInput = lArg + 8; }
+        else if (0 == strncmp("--iteration=", lArg, 12)) { lOK = ParseUInt(lArg + 12, &aOptions->mIteration); }
+        else if (0 == strncmp("--load="     , lArg,  7)) { lOK = ParseLoads(lArg + 7, aOptions); }
+        else if (0 == strncmp("--load-cpus=", lArg, 12)) { lOK = ParseList(lArg + 12, aOptions->mLoadCpus, &aOptions->mLoadCpuQty, LOAD_CPU_QTY_MAX); }
+        else if (0 == strncmp("--output="   , lArg,  9)) { aOptions->mOutput = lArg + 9; }
+        else if (0 == strncmp("--period-ms=", lArg, 12)) { lOK = ParseUInt(lArg + 12, &aOptions->mPeriod_ms); }
+        else if (0 == strncmp("--rate="     , lArg,  7)) { lOK = ParseList(lArg + 7, aOptions->mRates_Hz, &aOptions->mRateQty, RATE_QTY_MAX); }
+        else if (0 == strncmp("--vectors="  , lArg, 10)) { lOK = ParseUInt(lArg + 10, &aOptions->mVectorQty); }
+        else if (0 == strncmp("--window-s=" , lArg, 11)) { lOK = ParseUInt(lArg + 11, &aOptions->mWindow_s); }
+        else
+        {
+            lOK = false;
+        }
+
+        if (!lOK)
+        {
+            std::cout << "ERROR  Invalid argument - " << lArg << std::endl;
+            return false;
+        }
     }
 
-    // TODO  Configure the Intel chip
-    volatile uint32_t* lReg;
+    if (0 == aOptions->mIteration)
+    {
+        std::cout << "ERROR  The iteration count must not be 0" << std::endl;
+        return false;
+    }
 
-    lReg = reinterpret_cast<volatile uint32_t*>(lBAR0);
+    if ((0 == aOptions->mVectorQty) || (VECTOR_QTY_MAX < aOptions->mVectorQty))
+    {
+        std::cout << "ERROR  The vector count must be 1 to " << VECTOR_QTY_MAX << std::endl;
+        return false;
+    }
 
-    lReg[0x1508 / sizeof(uint32_t)] = INT_MASK;
+    if ((0 != (aOptions->mDeliveries & (1 << DELIVERY_POLL))) && (TRIGGER_NIC != aOptions->mTrigger))
+    {
+        std::cout << "ERROR  The poll delivery needs the nic trigger" << std::endl;
+        return false;
+    }
 
-    for (unsigned int i = 0; i < ITERATION; i++)
+    if ((FORMAT_BINARY == aOptions->mFormat) && ((nullptr == aOptions->mOutput) || (nullptr != aOptions->mInput)))
     {
-        std::cout << i << " " << sInterruptCount << "\r";
+        std::cout << "ERROR  The binary format needs --output and cannot be used with --input" << std::endl;
+        return false;
+    }
 
-        auto lDummy = lReg[0x1500 / sizeof(uint32_t)];
+    return true;
+}
 
-        auto lSample = sSamples + sInterruptCount;
+bool ParseDeliveries(const char* aIn, Options* aOptions)
+{
+    const char* lNames[DELIVERY_QTY];
 
-        lSample->BeforeTrig(i);
+    for (unsigned int i = 0; i < DELIVERY_QTY; i++)
+    {
+        lNames[i] = Delivery_GetName(static_cast<Delivery>(i));
+    }
 
-        if (SIMULATE)
+    return ParseNames(aIn, lNames, DELIVERY_QTY, &aOptions->mDeliveries);
+}
+
+bool ParseList(const char* aIn, unsigned int* aOut, unsigned int* aQty, unsigned int aMax)
+{
+    assert(nullptr != aOut);
+    assert(nullptr != aQty);
+
+    *aQty = 0;
+
+    auto lPtr = aIn;
+
+    for (;;)
+    {
+        if (aMax <= *aQty)
         {
-            lRet = lDD->Interrupt_Simulate(INT_MASK);
+            return false;
         }
-        else
+
+        char* lEnd;
+
+        auto lValue = strtoul(lPtr, &lEnd, 0);
+        if (lPtr == lEnd)
         {
-            lReg[0x1504 / sizeof(uint32_t)] = INT_MASK;
+            return false;
         }
 
-        lSample->AfterTrig();
+        aOut[*aQty] = lValue;
+        (*aQty)++;
 
-        Sleep(PERIOD_ms);
+        if ('\0' == *lEnd)
+        {
+            break;
+        }
+
+        if (',' != *lEnd)
+        {
+            return false;
+        }
+
+        lPtr = lEnd + 1;
     }
 
-    std::cout << std::endl;
+    return true;
+}
 
-    lRet = lDD->Interrupt_Unregister();
-    assert(DrvDMA_OK == lRet);
+bool ParseLoads(const char* aIn, Options* aOptions)
+{
+    const char* lNames[LOAD_QTY];
+
+    for (unsigned int i = 0; i < LOAD_QTY; i++)
+    {
+        lNames[i] = Load_GetName(static_cast<LoadType>(i));
+    }
+
+    return ParseNames(aIn, lNames, LOAD_QTY, &aOptions->mLoads);
+}
+
+// aOut [---;-W-] Bit mask of the names found in the list
+bool ParseNames(const char* aIn, const char** aNames, unsigned int aQty, unsigned int* aOut)
+{
+    *aOut = 0;
+
+    auto lPtr = aIn;
 
-    if (ITERATION > sInterruptCount)
+    for (;;)
     {
-        std::cout << "WARNING  " << (ITERATION - sInterruptCount) << " interrupt lost" << std::endl;
+        unsigned int i;
+
+        for (i = 0; i < aQty; i++)
+        {
+            auto lLen = strlen(aNames[i]);
+
+            if ((0 == strncmp(aNames[i], lPtr, lLen)) && ((',' == lPtr[lLen]) || ('\0' == lPtr[lLen])))
+            {
+                *aOut |= 1 << i;
+                lPtr += lLen;
+                break;
+            }
+        }
+
+        if (aQty <= i)
+        {
+            return false;
+        }
+
+        if ('\0' == *lPtr)
+        {
+            break;
+        }
+
+        lPtr++;
     }
 
-    for (unsigned int i = 0; i < sInterruptCount; i++)
+    return true;
+}
+
+bool ParsePlacement(const char* aIn, Placement* aOut)
+{
+    return ParseList(aIn, aOut->mValues, &aOut->mQty, PLACEMENT_QTY_MAX);
+}
+
+bool ParseUInt(const char* aIn, unsigned int* aOut)
+{
+    char* lEnd;
+
+    auto lValue = strtoull(aIn, &lEnd, 0);
+
+    *aOut = static_cast<unsigned int>(lValue);
+
+    return (aIn != lEnd) && ('\0' == *lEnd) && (UINT32_MAX >= lValue);
+}
+
+// Apply the combination aIndex of the placement values, the first option
+// varying the fastest.
+//
+// Return  The name of the combination, each value followed by a space
+std::string Placement_Apply(const Options& aOptions, unsigned int aIndex)
+{
+    auto lCallbackCpu  = Placement_GetValue(aOptions.mCallbackCpus , &aIndex);
+    auto lCallbackFifo = Placement_GetValue(aOptions.mCallbackFifos, &aIndex);
+    auto lTriggerCpu   = Placement_GetValue(aOptions.mTriggerCpus  , &aIndex);
+    auto lTriggerFifo  = Placement_GetValue(aOptions.mTriggerFifos , &aIndex);
+
+    std::string lResult;
+
+    if (THREAD_KEEP != lTriggerCpu)
     {
-        auto lSample = sSamples + i;
+        if (!Thread_SetAffinity(lTriggerCpu))
+        {
+            std::cout << "WARNING  Cannot run the trigger thread on the core " << lTriggerCpu << std::endl;
+        }
 
-        std::cout << *lSample;
+        lResult += "trigger-cpu=" + std::to_string(lTriggerCpu) + " ";
+    }
 
-        if (lSample->IsValid())
+    if (THREAD_KEEP != lTriggerFifo)
+    {
+        if (!Thread_SetPriority(lTriggerFifo))
         {
-            auto lTrig_us = sSamples[i].GetTrig();
-            auto lUser_us = sSamples[i].GetUser();
+            std::cout << "WARNING  Cannot set the priority " << lTriggerFifo << " of the trigger thread" << std::endl;
+        }
+
+        lResult += "trigger-fifo=" + std::to_string(lTriggerFifo) + " ";
+    }
 
-            std::cout << ";" << lTrig_us << ";" << lUser_us;
+    if ((THREAD_KEEP != lCallbackCpu) || (THREAD_KEEP != lCallbackFifo))
+    {
+        Trigger_SetCallbackPlacement(lCallbackCpu, lCallbackFifo);
 
-            lTrig.AddSample(lTrig_us);
+        if (THREAD_KEEP != lCallbackCpu)
+        {
+            lResult += "callback-cpu=" + std::to_string(lCallbackCpu) + " ";
+        }
 
-            if (TRIG_MAX_us >= lTrig_us)
-            {
-                lUser.AddSample(lUser_us);
+        if (THREAD_KEEP != lCallbackFifo)
+        {
+            lResult += "callback-fifo=" + std::to_string(lCallbackFifo) + " ";
+        }
+    }
+
+    return lResult;
+}
 
-                std::cout << ";Used\n";
+unsigned int Placement_GetQty(const Placement& aIn)
+{
+    return (0 < aIn.mQty) ? aIn.mQty : 1;
+}
+
+// aIndex [---;RW-] Divided by the count of values
+//
+// Return  The value or THREAD_KEEP if the option is not used
+unsigned int Placement_GetValue(const Placement& aIn, unsigned int* aIndex)
+{
+    if (0 == aIn.mQty)
+    {
+        return THREAD_KEEP;
+    }
+
+    auto lResult = aIn.mValues[*aIndex % aIn.mQty];
+
+    *aIndex /= aIn.mQty;
+
+    return lResult;
+}
+
+int Period(DrvDMA* aDD, volatile uint32_t* aReg, const Options& aOptions, Capture* aCapture)
+{
+    assert(nullptr != aCapture);
+
+    aCapture->Reset();
+    Trigger_Reset();
+
+    aCapture->Start();
+
+    uint64_t lProgress = 0;
+    double   lUser_us  = 0.0;
+
+    for (unsigned int i = 0; i < aOptions.mIteration; i++)
+    {
+        // Without --output, the samples go to std::cout.
+        if (nullptr != aOptions.mOutput)
+        {
+            // The statistics are read while the writer thread updates
+            // them. Merging the shards costs a few us, so once per
+            // PROGRESS_ms.
+            auto lNow = Clock_GetNow();
+            if (lProgress <= lNow)
+            {
+                lProgress = lNow + Clock_GetFrequency() / 1000 * PROGRESS_ms;
+                lUser_us  = aCapture->GetUser().GetPercentile(99.0);
             }
-            else
+
+            std::cout << i << " " << Trigger_GetInterruptCount(0) << " User p99 = " << lUser_us << " us";
+
+            if (0 < aOptions.mWindow_s)
             {
-                std::cout << ";Ignored\n";
+                double lDecay_us;
+                double lWindow_us;
+
+                aCapture->GetUserP99(&lWindow_us, &lDecay_us);
+
+                std::cout << ", last " << aOptions.mWindow_s << " s = " << lWindow_us << " us, decaying = " << lDecay_us << " us";
             }
+
+            std::cout << "  \r";
         }
-        else
+
+        if (!Trigger_Fire(aDD, aReg, Trigger_GetMask(aOptions, i), i, aCapture))
         {
-            std::cout << ";;;Invalid\n";
+            break;
         }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(aOptions.mPeriod_ms));
     }
 
-    std::cout << "Trigger : " << lTrig << std::endl;
-    std::cout << "User    : " << lUser << std::endl;
+    std::cout << std::endl;
 
-    lResult = 0;
+    aCapture->Stop();
 
-End1:
-    lRet = lDD->Disconnect();
-    assert(DrvDMA_OK == lRet);
+    for (unsigned int v = 0; v < aOptions.mVectorQty; v++)
+    {
+        auto lInterruptCount = Trigger_GetInterruptCount(v);
+        auto lTriggerCount   = Trigger_GetTriggerCount  (v);
 
-    std::cout << "Disconnected" << std::endl;
+        if (lTriggerCount > lInterruptCount)
+        {
+            std::cout << "WARNING  " << (lTriggerCount - lInterruptCount) << " interrupt lost on vector " << v << std::endl;
+        }
+    }
 
-End0:
-    lDD->Delete();
+    if (0 < aCapture->GetDropped())
+    {
+        std::cout << "WARNING  " << aCapture->GetDropped() << " sample dropped" << std::endl;
+    }
+
+    Report_Display(aOptions, *aCapture, Clock_ToMicroSeconds(Clock_GetOverhead(), Clock_GetFrequency()));
+
+    if (1 < aOptions.mVectorQty)
+    {
+        Period_Display(aOptions, *aCapture);
+    }
+
+    return 0;
+}
+
+// Display the per vector counters and how the DrvDMA stack delivered the
+// callbacks of the different vectors.
+void Period_Display(const Options& aOptions, const Capture& aCapture)
+{
+    Trigger_CallbackStats lStats;
+
+    Trigger_GetCallbackStats(&lStats);
+
+    std::cout << "Vector;Triggers;Interrupts;Coalesced;Extra\n";
+
+    for (unsigned int v = 0; v < aOptions.mVectorQty; v++)
+    {
+        std::cout << v << ";" << Trigger_GetTriggerCount(v) << ";" << Trigger_GetInterruptCount(v) << ";" << aCapture.GetCoalesced(v) << ";" << aCapture.GetExtra(v) << "\n";
+    }
+
+    std::cout << "Callbacks                     : " << lStats.mCallbacks << "\n";
+    std::cout << "Callbacks with many vectors   : " << lStats.mMerged << "\n";
+    std::cout << "Callbacks overlapping another : " << lStats.mOverlapped << "\n";
+    std::cout << "Samples lost to an overlap    : " << lStats.mCollided << "\n";
+    std::cout << "Concurrent callbacks, maximum : " << lStats.mConcurrencyMax << std::endl;
+}
+
+// Run the test for each combination of the --callback-... and --trigger-...
+// values, with each --delivery model and, for each of them, without load,
+// then with each load. With more than one run and in period mode, compare
+// the distributions.
+int Run(DrvDMA* aDD, volatile uint32_t* aReg, const Options& aOptions, Capture* aCapture)
+{
+    auto lPlacementQty = Placement_GetQty(aOptions.mCallbackCpus) * Placement_GetQty(aOptions.mCallbackFifos) * Placement_GetQty(aOptions.mTriggerCpus) * Placement_GetQty(aOptions.mTriggerFifos);
+    auto lRunQty       = lPlacementQty * CountBits(aOptions.mDeliveries) * (1 + CountBits(aOptions.mLoads));
+
+    Results lResults;
+
+    lResults.mNames.reserve(lRunQty);
+    lResults.mTrigs.resize (lRunQty);
+    lResults.mUsers.resize (lRunQty);
+
+    int lResult = 0;
+
+    for (unsigned int p = 0; (0 == lResult) && (p < lPlacementQty); p++)
+    {
+        auto lPlacement = Placement_Apply(aOptions, p);
+
+        for (unsigned int d = 0; (0 == lResult) && (d < DELIVERY_QTY); d++)
+        {
+            auto lDelivery = static_cast<Delivery>(d);
+
+            if (0 == (aOptions.mDeliveries & (1 << d)))
+            {
+                continue;
+            }
+
+            auto lName = lPlacement;
+
+            if (1 < CountBits(aOptions.mDeliveries))
+            {
+                lName += std::string("delivery=") + Delivery_GetName(lDelivery) + " ";
+            }
+
+            if (!Delivery_Start(lDelivery, aDD, aReg, aOptions, aCapture))
+            {
+                return __LINE__;
+            }
+
+            lResult = RunLoads(aDD, aReg, aOptions, aCapture, lName, 1 < lRunQty, &lResults);
+
+            Delivery_Stop();
+        }
+    }
+
+    if ((0 == lResult) && (0 == aOptions.mRateQty) && (1 < lRunQty))
+    {
+        Report_Compare(lResults.mNames.data(), lResults.mTrigs.data(), lResults.mUsers.data(), static_cast<unsigned int>(lResults.mNames.size()));
+    }
 
     return lResult;
 }
 
-// Static functions
-// //////////////////////////////////////////////////////////////////////////
+// aName     The name of the configuration, each value followed by a space
+// aHeader   Display the name before each run
+// aResults  [---;RW-] Receives the name and the statistics of each run
+int RunLoads(DrvDMA* aDD, volatile uint32_t* aReg, const Options& aOptions, Capture* aCapture, const std::string& aName, bool aHeader, Results* aResults)
+{
+    assert(nullptr != aCapture);
+    assert(nullptr != aResults);
+
+    int lResult = 0;
+
+    // c = 0 is the run without load, c = 1 + LoadType the others.
+    for (unsigned int c = 0; (0 == lResult) && (LOAD_QTY >= c); c++)
+    {
+        auto lType = static_cast<LoadType>(c - 1);
+
+        if ((0 < c) && (0 == (aOptions.mLoads & (1 << lType))))
+        {
+            continue;
+        }
+
+        auto lName = aName;
+
+        if (0 != aOptions.mLoads)
+        {
+            lName += std::string("load=") + ((0 == c) ? "none" : Load_GetName(lType)) + " ";
+        }
+
+        aResults->mNames.push_back(lName.empty() ? "default" : lName.substr(0, lName.size() - 1));
+
+        if (aHeader)
+        {
+            std::cout << "===== " << aResults->mNames.back() << " =====" << std::endl;
+        }
+
+        if (0 < c)
+        {
+            Load_Start(lType, aOptions);
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(LOAD_WARM_UP_ms));
+        }
 
-// ===== Entry point ========================================================
+        auto lStart = Clock_GetNow();
 
-void OnInterrupt(void* aContext, uint64_t aInterrupts)
+        lResult = Test(aDD, aReg, aOptions, aCapture);
+
+        if (0 < c)
+        {
+            auto lOperations = Load_Stop();
+            auto lDuration_s = static_cast<double>(Clock_GetNow() - lStart) / Clock_GetFrequency();
+
+            std::cout << "Load " << Load_GetName(lType) << " : " << (lOperations / lDuration_s) << " " << Load_GetUnit(lType) << "/s" << std::endl;
+        }
+
+        if ((0 < aOptions.mCallbackCpus.mQty) || (0 < aOptions.mCallbackFifos.mQty))
+        {
+            Trigger_CallbackStats lStats;
+
+            Trigger_GetCallbackStats(&lStats);
+
+            std::cout << "Callback threads placed : " << lStats.mPlaced << ", failed " << lStats.mPlaceFailed << std::endl;
+        }
+
+        auto lIndex = aResults->mNames.size() - 1;
+
+        aResults->mTrigs[lIndex] = aCapture->GetTrig();
+        aResults->mUsers[lIndex] = aCapture->GetUser();
+    }
+
+    return lResult;
+}
+
+// Each rate step triggers --iteration interrupts, spinning on the clock
+// between them. The schedule is absolute, so a late trigger is followed by
+// shorter gaps until the step is back on time. After the last trigger, the
+// step waits DRAIN_ms for the late interrupts.
+//
+// The callback is attributed to the last trigger of its vector, so when
+// interrupts queue up or coalesce, the user latency is a lower bound. The
+// Coalesced column counts the triggers without their own callback,
+// followed by a callback for a later trigger.
+//
+// Each step displays one line per vector. The callback columns are the
+// same on all the lines of a step.
+int Storm(DrvDMA* aDD, volatile uint32_t* aReg, const Options& aOptions, Capture* aCapture)
 {
-    auto lInterruptCount = InterlockedIncrement(&sInterruptCount) - 1;
-    assert(ITERATION > lInterruptCount);
+    assert(nullptr != aCapture);
+
+    auto lFrequency = Clock_GetFrequency();
+    unsigned int lIteration = 0;
+
+    std::cout << "Rate_Hz;Vector;Trigger_Hz;Delivered_Hz;Triggers;Interrupts;Lost;Coalesced;Extra;User_p50_us;User_p99_us;User_p99.9_us;User_p99.99_us;User_Max_us;Callbacks;Merged;Overlapped;Collided;Concurrency_Max\n";
+
+    for (unsigned int r = 0; r < aOptions.mRateQty; r++)
+    {
+        auto lRate_Hz = aOptions.mRates_Hz[r];
 
-    auto lSample = sSamples + lInterruptCount;
+        // 0 means as fast as possible.
+        uint64_t lPeriod = (0 == lRate_Hz) ? 0 : lFrequency / lRate_Hz;
+
+        aCapture->Reset();
+        Trigger_Reset();
+
+        aCapture->Start();
+
+        auto lStart = Clock_GetNow();
+        auto lNext  = lStart;
+
+        unsigned int i;
+
+        for (i = 0; i < aOptions.mIteration; i++)
+        {
+            while (Clock_GetNow() < lNext)
+            {
+            }
+
+            if (!Trigger_Fire(aDD, aReg, Trigger_GetMask(aOptions, lIteration), lIteration, aCapture))
+            {
+                break;
+            }
+
+            lIteration++;
+            lNext += lPeriod;
+        }
+
+        auto lDuration = Clock_GetNow() - lStart;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(DRAIN_ms));
+
+        aCapture->Stop();
+
+        if (aOptions.mIteration > i)
+        {
+            return __LINE__;
+        }
+
+        Trigger_CallbackStats lStats;
+
+        Trigger_GetCallbackStats(&lStats);
+
+        auto lDuration_s = static_cast<double>(lDuration) / lFrequency;
+
+        for (unsigned int v = 0; v < aOptions.mVectorQty; v++)
+        {
+            auto  lInterruptCount = Trigger_GetInterruptCount(v);
+            auto  lTriggerCount   = Trigger_GetTriggerCount  (v);
+            auto  lUser           = aCapture->GetUser(v);
+
+            std::cout << lRate_Hz << ";" << v << ";" << (lTriggerCount / lDuration_s) << ";" << (lInterruptCount / lDuration_s) << ";";
+            std::cout << lTriggerCount << ";" << lInterruptCount << ";" << ((lTriggerCount > lInterruptCount) ? (lTriggerCount - lInterruptCount) : 0) << ";";
+            std::cout << aCapture->GetCoalesced(v) << ";" << aCapture->GetExtra(v) << ";";
+            std::cout << lUser.GetPercentile(50.0) << ";" << lUser.GetPercentile(99.0) << ";" << lUser.GetPercentile(99.9) << ";" << lUser.GetPercentile(99.99) << ";" << lUser.GetMax() << ";";
+            std::cout << lStats.mCallbacks << ";" << lStats.mMerged << ";" << lStats.mOverlapped << ";" << lStats.mCollided << ";" << lStats.mConcurrencyMax << std::endl;
+        }
+
+        if (0 < aCapture->GetDropped())
+        {
+            std::cout << "WARNING  " << aCapture->GetDropped() << " sample dropped" << std::endl;
+        }
+
+        if (aOptions.mHistogram)
+        {
+            for (unsigned int v = 0; v < aOptions.mVectorQty; v++)
+            {
+                std::cout << "User histogram, vector " << v << "\nLow_us;High_us;Count;Cumulative_%\n";
+                aCapture->GetUser(v).Dump(std::cout);
+            }
+        }
+    }
+
+    return 0;
+}
+
+int Test(DrvDMA* aDD, volatile uint32_t* aReg, const Options& aOptions, Capture* aCapture)
+{
+    if (0 < aOptions.mRateQty)
+    {
+        return Storm(aDD, aReg, aOptions, aCapture);
+    }
 
-    lSample->OnInterrupt(aInterrupts);
+    return Period(aDD, aReg, aOptions, aCapture);
 }
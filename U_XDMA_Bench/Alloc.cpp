@@ -0,0 +1,144 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Alloc.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "BufferPool.h"
+#include "Channel.h"
+#include "Clock.h"
+#include "Pipeline.h"
+#include "Report.h"
+
+#include "Modes.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+static const char* COLUMNS[] =
+{
+    "direction", "alloc", "huge_page", "setup_ms", "size_byte", "depth", "iteration", "speed_GB_s", "start_us", nullptr
+};
+
+static const Alloc ALLOCS[] = { ALLOC_LEGACY, ALLOC_PAGE, ALLOC_HUGE };
+
+static const char* ALLOC_NAMES[] = { "huge", "legacy", "page" };
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static int Alloc_Compare(DrvDMA* aDD, const Options& aOptions, bool aFromDevice, Report* aReport);
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+int Mode_Alloc(DrvDMA* aDD, const Options& aOptions, FILE* aOut)
+{
+    int lResult = 0;
+
+    Report lReport(aOut, aOptions.mFormat, COLUMNS);
+
+    if (0 != (aOptions.mDirections & DIRECTION_H2C))
+    {
+        lResult = Alloc_Compare(aDD, aOptions, false, &lReport);
+    }
+
+    if ((0 == lResult) && (0 != (aOptions.mDirections & DIRECTION_C2H)))
+    {
+        lResult = Alloc_Compare(aDD, aOptions, true, &lReport);
+    }
+
+    return lResult;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+int Alloc_Compare(DrvDMA* aDD, const Options& aOptions, bool aFromDevice, Report* aReport)
+{
+    auto lDirection = aFromDevice ? "C2H" : "H2C";
+
+    unsigned int lCI;
+
+    auto lRet = Channel_Open(aDD, aOptions, aFromDevice, 0, &lCI);
+    if (DrvDMA_OK != lRet)
+    {
+        return __LINE__;
+    }
+
+    Pipeline lPipeline(aDD, lCI, aFromDevice, aOptions.mHardwareAddress);
+
+    for (auto lAlloc : ALLOCS)
+    {
+        bool lHugePage = false;
+
+        // The legacy allocator allocates and fills the buffers for each
+        // run, the pools do it once here.
+        auto lBefore_ns = Clock_GetNow_ns();
+
+        BufferPool* lPool = nullptr;
+
+        if (ALLOC_LEGACY != lAlloc)
+        {
+            lPool = BufferPool::Create(lAlloc, aOptions.mNode, Options_GetDepthMax(aOptions), aOptions.mSizeMax_byte);
+            if (nullptr == lPool)
+            {
+                return __LINE__;
+            }
+
+            lHugePage = lPool->IsHugePage();
+        }
+
+        double lSetup_ms = static_cast<double>(Clock_GetNow_ns() - lBefore_ns) / 1000000.0;
+
+        lPipeline.SetPool(lPool);
+
+        for (auto lSize_byte = aOptions.mSizeMin_byte; lSize_byte <= aOptions.mSizeMax_byte; lSize_byte *= 2)
+        {
+            for (unsigned int d = 0; d < aOptions.mDepthQty; d++)
+            {
+                Pipeline::Config lConfig;
+                Pipeline::Result lResult;
+
+                lConfig.mBufferQty       = aOptions.mDepths[d];
+                lConfig.mBufferSize_byte = lSize_byte;
+                lConfig.mCompletion      = COMPLETION_WAIT;
+                lConfig.mIntegrity       = nullptr;
+                lConfig.mIteration       = Options_GetIteration(aOptions, lSize_byte, lConfig.mBufferQty);
+                lConfig.mSpin_us         = 0;
+                lConfig.mStop            = nullptr;
+                lConfig.mTrace           = nullptr;
+
+                fprintf(stderr, "%s - %s - %u bytes - depth %u - %u iterations\n", lDirection, ALLOC_NAMES[lAlloc], lSize_byte, lConfig.mBufferQty, lConfig.mIteration);
+
+                lRet = lPipeline.Run(lConfig, &lResult);
+                if (DrvDMA_OK != lRet)
+                {
+                    return __LINE__;
+                }
+
+                aReport->Row_Begin();
+                aReport->Value(lDirection);
+                aReport->Value(ALLOC_NAMES[lAlloc]);
+                aReport->Value(static_cast<uint64_t>(lHugePage ? 1 : 0));
+                aReport->Value(lSetup_ms);
+                aReport->Value(static_cast<uint64_t>(lSize_byte));
+                aReport->Value(static_cast<uint64_t>(lConfig.mBufferQty));
+                aReport->Value(static_cast<uint64_t>(lResult.mIteration));
+                aReport->Value(Pipeline::GetSpeed_GB_s  (lResult));
+                aReport->Value(Pipeline::GetStartTime_us(lResult));
+                aReport->Row_End();
+            }
+
+            if (TRANSFER_SIZE_MAX_byte / 2 < lSize_byte)
+            {
+                break;
+            }
+        }
+    }
+
+    return 0;
+}
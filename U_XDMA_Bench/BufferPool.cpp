@@ -0,0 +1,228 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/BufferPool.cpp
+
+#include "Component.h"
+
+#ifdef _KMS_LINUX_
+    // ===== System =========================================================
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+// ===== Local ==============================================================
+#include "Numa.h"
+
+#include "BufferPool.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+#define HUGE_PAGE_SIZE_byte (2 * 1024 * 1024)
+#define PAGE_SIZE_byte      (4 * 1024)
+
+#ifdef _KMS_LINUX_
+    // See numaif.h, not used to avoid the libnuma dependency
+    #define MPOL_BIND (2)
+
+    #define NODE_MASK_QTY (16)
+#endif
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static size_t RoundUp(size_t aIn, size_t aAlign);
+
+// Public
+// //////////////////////////////////////////////////////////////////////////
+
+BufferPool* BufferPool::Create(Alloc aAlloc, int aNode, unsigned int aQty, unsigned int aSize_byte)
+{
+    assert(ALLOC_LEGACY != aAlloc);
+    assert(0 < aQty);
+    assert(0 < aSize_byte);
+
+    auto lResult = new BufferPool();
+
+    bool lRetB = false;
+
+    if (ALLOC_HUGE == aAlloc)
+    {
+        lResult->mBufferSize_byte = static_cast<unsigned int>(RoundUp(aSize_byte, HUGE_PAGE_SIZE_byte));
+
+        lRetB = lResult->Allocate(true, aNode, static_cast<size_t>(lResult->mBufferSize_byte) * aQty);
+        if (!lRetB)
+        {
+            fprintf(stderr, "WARNING  Huge pages are not available, using normal pages\n");
+        }
+    }
+
+    if (!lRetB)
+    {
+        lResult->mBufferSize_byte = static_cast<unsigned int>(RoundUp(aSize_byte, PAGE_SIZE_byte));
+
+        lRetB = lResult->Allocate(false, aNode, static_cast<size_t>(lResult->mBufferSize_byte) * aQty);
+        if (!lRetB)
+        {
+            fprintf(stderr, "ERROR  Cannot allocate %u buffers of %u bytes\n", aQty, aSize_byte);
+            delete lResult;
+            return nullptr;
+        }
+    }
+
+    // Touch every page now, so the first transfers do not pay the page
+    // faults. This is also when the pages are placed on the NUMA node.
+    memset(lResult->mBase, 0, lResult->mSize_byte);
+
+    lResult->mFree    = new void*[aQty];
+    lResult->mFreeQty = aQty;
+    lResult->mQty     = aQty;
+
+    for (unsigned int i = 0; i < aQty; i++)
+    {
+        lResult->mFree[i] = lResult->mBase + static_cast<size_t>(lResult->mBufferSize_byte) * (aQty - i - 1);
+    }
+
+    return lResult;
+}
+
+BufferPool::~BufferPool()
+{
+    assert(mQty == mFreeQty);
+
+    if (nullptr != mBase)
+    {
+        #ifdef _KMS_LINUX_
+            auto lRet = munmap(mBase, mSize_byte);
+            assert(0 == lRet);
+            (void)lRet;
+        #endif
+
+        #ifdef _KMS_WINDOWS_
+            auto lRetB = VirtualFree(mBase, 0, MEM_RELEASE);
+            assert(lRetB);
+            (void)lRetB;
+        #endif
+    }
+
+    if (nullptr != mFree)
+    {
+        delete[] mFree;
+    }
+}
+
+unsigned int BufferPool::GetBufferSize() const { return mBufferSize_byte; }
+
+bool BufferPool::IsHugePage() const { return mHugePage; }
+
+void* BufferPool::Acquire()
+{
+    assert(0 < mFreeQty);
+
+    mFreeQty--;
+
+    return mFree[mFreeQty];
+}
+
+void BufferPool::Release(void* aBuffer)
+{
+    assert(nullptr != aBuffer);
+    assert(mBase <= aBuffer);
+    assert(mBase + mSize_byte > aBuffer);
+    assert(mQty > mFreeQty);
+
+    mFree[mFreeQty] = aBuffer;
+    mFreeQty++;
+}
+
+// Private
+// //////////////////////////////////////////////////////////////////////////
+
+BufferPool::BufferPool() : mBase(nullptr), mBufferSize_byte(0), mFree(nullptr), mFreeQty(0), mHugePage(false), mQty(0), mSize_byte(0) {}
+
+bool BufferPool::Allocate(bool aHugePage, int aNode, size_t aSize_byte)
+{
+    assert(nullptr == mBase);
+
+    #ifdef _KMS_LINUX_
+        int lFlags = MAP_ANONYMOUS | MAP_PRIVATE;
+
+        if (aHugePage)
+        {
+            lFlags |= MAP_HUGETLB | (21 << MAP_HUGE_SHIFT);
+        }
+
+        auto lBase = mmap(nullptr, aSize_byte, PROT_READ | PROT_WRITE, lFlags, -1, 0);
+        if (MAP_FAILED == lBase)
+        {
+            return false;
+        }
+
+        if (NUMA_NODE_ANY != aNode)
+        {
+            assert(NODE_MASK_QTY * 64 > aNode);
+
+            uint64_t lMask[NODE_MASK_QTY];
+
+            memset(&lMask, 0, sizeof(lMask));
+
+            lMask[aNode / 64] = 1ULL << (aNode % 64);
+
+            if (0 != syscall(SYS_mbind, lBase, aSize_byte, MPOL_BIND, lMask, NODE_MASK_QTY * 64, 0))
+            {
+                fprintf(stderr, "ERROR  Cannot bind the memory to the NUMA node %d\n", aNode);
+                munmap(lBase, aSize_byte);
+                return false;
+            }
+        }
+
+        mBase = reinterpret_cast<uint8_t*>(lBase);
+    #endif
+
+    #ifdef _KMS_WINDOWS_
+        DWORD lType = MEM_COMMIT | MEM_RESERVE;
+
+        if (aHugePage)
+        {
+            // MEM_LARGE_PAGES needs the SeLockMemoryPrivilege privilege and
+            // a size multiple of GetLargePageMinimum().
+            auto lLarge_byte = GetLargePageMinimum();
+            if ((0 == lLarge_byte) || (0 != (aSize_byte % lLarge_byte)))
+            {
+                return false;
+            }
+
+            lType |= MEM_LARGE_PAGES;
+        }
+
+        if (NUMA_NODE_ANY == aNode)
+        {
+            mBase = reinterpret_cast<uint8_t*>(VirtualAlloc(nullptr, aSize_byte, lType, PAGE_READWRITE));
+        }
+        else
+        {
+            mBase = reinterpret_cast<uint8_t*>(VirtualAllocExNuma(GetCurrentProcess(), nullptr, aSize_byte, lType, PAGE_READWRITE, aNode));
+        }
+    #endif
+
+    if (nullptr == mBase)
+    {
+        return false;
+    }
+
+    mHugePage  = aHugePage;
+    mSize_byte = aSize_byte;
+
+    return true;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+size_t RoundUp(size_t aIn, size_t aAlign)
+{
+    return (aIn + aAlign - 1) / aAlign * aAlign;
+}
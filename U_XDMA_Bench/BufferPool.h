@@ -0,0 +1,56 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/BufferPool.h
+
+#pragma once
+
+// ===== Local ==============================================================
+#include "Options.h"
+
+// A set of DMA buffers allocated once, in one page or 2 MiB huge page
+// aligned region, and touched at creation. Acquire and Release hand the
+// buffers out and back without allocating memory. An instance is not
+// thread safe, use one per pipeline thread.
+class BufferPool
+{
+
+public:
+
+    // aAlloc      ALLOC_HUGE or ALLOC_PAGE. With ALLOC_HUGE, fall back to
+    //             normal pages when huge pages are not available.
+    // aNode       The NUMA node of the memory or NUMA_NODE_ANY
+    // aQty        The number of buffers
+    // aSize_byte  The size of each buffer
+    //
+    // Return  The new instance or nullptr if the allocation failed
+    static BufferPool* Create(Alloc aAlloc, int aNode, unsigned int aQty, unsigned int aSize_byte);
+
+    ~BufferPool();
+
+    unsigned int GetBufferSize() const;
+
+    bool IsHugePage() const;
+
+    // Return  A free buffer
+    void* Acquire();
+
+    // aBuffer  A buffer returned by Acquire
+    void Release(void* aBuffer);
+
+private:
+
+    BufferPool();
+
+    bool Allocate(bool aHugePage, int aNode, size_t aSize_byte);
+
+    uint8_t    * mBase;
+    unsigned int mBufferSize_byte;
+    void      ** mFree;
+    unsigned int mFreeQty;
+    bool         mHugePage;
+    unsigned int mQty;
+    size_t       mSize_byte;
+
+};
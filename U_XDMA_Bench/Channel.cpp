@@ -0,0 +1,95 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Channel.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "Channel.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+// See AMD_XDMA_REGS in U_Test
+#define C2H_OFFSET_byte   (0x1000)
+#define CHANNEL_SIZE_byte (0x100)
+#define H2C_OFFSET_byte   (0x0000)
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+DrvDMA_Result Channel_Open(DrvDMA* aDD, const Options& aOptions, bool aFromDevice, unsigned int aIndex, unsigned int* aCI)
+{
+    assert(nullptr != aDD);
+    assert(XDMA_CHANNEL_QTY > aIndex);
+    assert(nullptr != aCI);
+
+    DrvDMA_Channel_Config lCfg;
+
+    memset(&lCfg, 0, sizeof(lCfg));
+
+    if (aOptions.mSimulate)
+    {
+        // Same configuration as U_Simple
+        lCfg.mEngine            = DrvDMA_SIM;
+        lCfg.mFlags.mFromDevice = true;
+        lCfg.mFlags.mToDevice   = true;
+        lCfg.mFlags.mUser       = true;
+    }
+    else
+    {
+        // Same configuration as U_XDMA_H2C and U_XDMA_C2H
+        lCfg.mDescQty          = 65536;
+        lCfg.mEngine           = DrvDMA_AMD_XDMA;
+        lCfg.mFlags.mExclusive = true;
+        lCfg.mFlags.mKernel    = true;
+        lCfg.mMem_Index        = aOptions.mBAR;
+        lCfg.mMem_Offset_byte  = CHANNEL_SIZE_byte * aIndex;
+
+        if (aFromDevice)
+        {
+            lCfg.mFlags.mFromDevice = true;
+            lCfg.mMem_Offset_byte += C2H_OFFSET_byte;
+        }
+        else
+        {
+            lCfg.mFlags.mToDevice = true;
+            lCfg.mMem_Offset_byte += H2C_OFFSET_byte;
+        }
+    }
+
+    auto lResult = aDD->Channel_Config(lCfg, aCI);
+    if (DrvDMA_RESULT_OK(lResult))
+    {
+        lResult = DrvDMA_OK;
+    }
+    else
+    {
+        fprintf(stderr, "ERROR  DrvDMA::Channel_Config failed - %s\n", DrvDMA::GetResultName(lResult));
+    }
+
+    return lResult;
+}
+
+volatile uint32_t* Channel_GetRegisters(DrvDMA* aDD, const Options& aOptions, bool aFromDevice, unsigned int aIndex)
+{
+    assert(nullptr != aDD);
+    assert(XDMA_CHANNEL_QTY > aIndex);
+
+    if (aOptions.mSimulate)
+    {
+        return nullptr;
+    }
+
+    unsigned int lOffset_byte = (aFromDevice ? C2H_OFFSET_byte : H2C_OFFSET_byte) + CHANNEL_SIZE_byte * aIndex;
+
+    auto lBase = reinterpret_cast<volatile uint8_t*>(aDD->Memory_GetAddress(aOptions.mBAR));
+    if ((nullptr == lBase) || (aDD->Memory_GetSize(aOptions.mBAR) < lOffset_byte + CHANNEL_SIZE_byte))
+    {
+        return nullptr;
+    }
+
+    return reinterpret_cast<volatile uint32_t*>(lBase + lOffset_byte);
+}
@@ -0,0 +1,40 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Channel.h
+
+#pragma once
+
+// ===== Local ==============================================================
+#include "Options.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+// A XDMA engine has up to 4 H2C and 4 C2H channels.
+#define XDMA_CHANNEL_QTY (4)
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+// aDD          The DrvDMA instance, connected unless aOptions.mSimulate is
+//              set
+// aOptions     The options
+// aFromDevice  true for C2H, false for H2C
+// aIndex       The index of the XDMA channel (0 to 3)
+// aCI    [---;-W-] The logical index of the configured channel
+//
+// Return
+//  DrvDMA_OK
+//  ...        See DrvDMA::Channel_Config
+extern DrvDMA_Result Channel_Open(DrvDMA* aDD, const Options& aOptions, bool aFromDevice, unsigned int aIndex, unsigned int* aCI);
+
+// aDD          The DrvDMA instance
+// aOptions     The options
+// aFromDevice  true for C2H, false for H2C
+// aIndex       The index of the XDMA channel (0 to 3)
+//
+// Return  The address of the channel registers or nullptr when they are
+//         not mapped, as with the DrvDMA_SIM engine
+extern volatile uint32_t* Channel_GetRegisters(DrvDMA* aDD, const Options& aOptions, bool aFromDevice, unsigned int aIndex);
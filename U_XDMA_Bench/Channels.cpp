@@ -0,0 +1,211 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Channels.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "Channel.h"
+#include "Group.h"
+#include "Report.h"
+
+#include "Modes.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+static const char* COLUMNS[] =
+{
+    "size_byte", "depth", "channels", "direction", "channel", "iteration", "speed_GB_s", nullptr
+};
+
+static const char* CHANNEL_NAMES[XDMA_CHANNEL_QTY] = { "0", "1", "2", "3" };
+
+#define PIPELINE_QTY_MAX (2 * XDMA_CHANNEL_QTY)
+
+// Data types
+// //////////////////////////////////////////////////////////////////////////
+
+typedef struct
+{
+    // Index 0 to XDMA_CHANNEL_QTY - 1 are the H2C channels, the other the
+    // C2H channels. A nullptr entry is a direction not measured.
+    Pipeline* mPipelines[PIPELINE_QTY_MAX];
+}
+Context;
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static int Measure(Context* aContext, const Options& aOptions, unsigned int aSize_byte, unsigned int aDepth, Report* aReport);
+
+static void Row(Report* aReport, unsigned int aSize_byte, unsigned int aDepth, unsigned int aN, const char* aDirection, const char* aChannel, const Pipeline::Result& aResult);
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+int Mode_Channels(DrvDMA* aDD, const Options& aOptions, FILE* aOut)
+{
+    Context lContext;
+    int     lResult = 0;
+
+    memset(&lContext, 0, sizeof(lContext));
+
+    for (unsigned int i = 0; (0 == lResult) && (i < PIPELINE_QTY_MAX); i++)
+    {
+        auto lFromDevice = (XDMA_CHANNEL_QTY <= i);
+        auto lIndex      = i % XDMA_CHANNEL_QTY;
+
+        if ((aOptions.mChannelQty <= lIndex) || (0 == (aOptions.mDirections & (lFromDevice ? DIRECTION_C2H : DIRECTION_H2C))))
+        {
+            continue;
+        }
+
+        unsigned int lCI;
+
+        if (DrvDMA_OK != Channel_Open(aDD, aOptions, lFromDevice, lIndex, &lCI))
+        {
+            lResult = __LINE__;
+            break;
+        }
+
+        lContext.mPipelines[i] = new Pipeline(aDD, lCI, lFromDevice, aOptions.mHardwareAddress);
+
+        if (!lContext.mPipelines[i]->Pool_Create(aOptions))
+        {
+            lResult = __LINE__;
+        }
+    }
+
+    if (0 == lResult)
+    {
+        Report lReport(aOut, aOptions.mFormat, COLUMNS);
+
+        for (auto lSize_byte = aOptions.mSizeMin_byte; (0 == lResult) && (lSize_byte <= aOptions.mSizeMax_byte); lSize_byte *= 2)
+        {
+            for (unsigned int d = 0; (0 == lResult) && (d < aOptions.mDepthQty); d++)
+            {
+                lResult = Measure(&lContext, aOptions, lSize_byte, aOptions.mDepths[d], &lReport);
+            }
+
+            if (TRANSFER_SIZE_MAX_byte / 2 < lSize_byte)
+            {
+                break;
+            }
+        }
+    }
+
+    for (auto lPipeline : lContext.mPipelines)
+    {
+        if (nullptr != lPipeline)
+        {
+            delete lPipeline;
+        }
+    }
+
+    return lResult;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+// Run 1 to mChannelQty channels per direction at the same time, one thread
+// per channel.
+int Measure(Context* aContext, const Options& aOptions, unsigned int aSize_byte, unsigned int aDepth, Report* aReport)
+{
+    Pipeline::Config lConfig;
+
+    lConfig.mBufferQty       = aDepth;
+    lConfig.mBufferSize_byte = aSize_byte;
+    lConfig.mCompletion      = COMPLETION_WAIT;
+    lConfig.mIntegrity       = nullptr;
+    lConfig.mIteration       = Options_GetIteration(aOptions, aSize_byte, aDepth);
+    lConfig.mSpin_us         = 0;
+    lConfig.mStop            = nullptr;
+    lConfig.mTrace           = nullptr;
+
+    for (unsigned int lN = 1; lN <= aOptions.mChannelQty; lN++)
+    {
+        fprintf(stderr, "%u bytes - depth %u - %u channels - %u iterations\n", aSize_byte, aDepth, lN, lConfig.mIteration);
+
+        Pipeline*        lPipelines[PIPELINE_QTY_MAX];
+        Pipeline::Result lResults  [PIPELINE_QTY_MAX];
+        unsigned int     lCount_C2H = 0;
+        unsigned int     lCount_H2C = 0;
+
+        // H2C first, then C2H
+        for (unsigned int i = 0; i < lN; i++)
+        {
+            auto lP = aContext->mPipelines[i];
+            if (nullptr != lP)
+            {
+                lPipelines[lCount_H2C] = lP;
+                lCount_H2C++;
+            }
+        }
+
+        for (unsigned int i = 0; i < lN; i++)
+        {
+            auto lP = aContext->mPipelines[XDMA_CHANNEL_QTY + i];
+            if (nullptr != lP)
+            {
+                lPipelines[lCount_H2C + lCount_C2H] = lP;
+                lCount_C2H++;
+            }
+        }
+
+        auto lCount = lCount_C2H + lCount_H2C;
+
+        if (!Group_Run(lPipelines, lConfig, lCount, lResults))
+        {
+            return __LINE__;
+        }
+
+        Pipeline::Result lAll;
+
+        for (unsigned int i = 0; i < lCount_H2C; i++)
+        {
+            Row(aReport, aSize_byte, aDepth, lN, "H2C", CHANNEL_NAMES[i], lResults[i]);
+        }
+
+        if (0 < lCount_H2C)
+        {
+            Group_Combine(lResults, lCount_H2C, &lAll);
+            Row(aReport, aSize_byte, aDepth, lN, "H2C", "all", lAll);
+        }
+
+        for (unsigned int i = 0; i < lCount_C2H; i++)
+        {
+            Row(aReport, aSize_byte, aDepth, lN, "C2H", CHANNEL_NAMES[i], lResults[lCount_H2C + i]);
+        }
+
+        if (0 < lCount_C2H)
+        {
+            Group_Combine(lResults + lCount_H2C, lCount_C2H, &lAll);
+            Row(aReport, aSize_byte, aDepth, lN, "C2H", "all", lAll);
+        }
+
+        if ((0 < lCount_C2H) && (0 < lCount_H2C))
+        {
+            Group_Combine(lResults, lCount, &lAll);
+            Row(aReport, aSize_byte, aDepth, lN, "both", "all", lAll);
+        }
+    }
+
+    return 0;
+}
+
+void Row(Report* aReport, unsigned int aSize_byte, unsigned int aDepth, unsigned int aN, const char* aDirection, const char* aChannel, const Pipeline::Result& aResult)
+{
+    aReport->Row_Begin();
+    aReport->Value(static_cast<uint64_t>(aSize_byte));
+    aReport->Value(static_cast<uint64_t>(aDepth));
+    aReport->Value(static_cast<uint64_t>(aN));
+    aReport->Value(aDirection);
+    aReport->Value(aChannel);
+    aReport->Value(static_cast<uint64_t>(aResult.mIteration));
+    aReport->Value(Pipeline::GetSpeed_GB_s(aResult));
+    aReport->Row_End();
+}
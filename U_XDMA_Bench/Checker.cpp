@@ -0,0 +1,115 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Checker.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "BufferPool.h"
+#include "Clock.h"
+#include "Pattern.h"
+#include "Report.h"
+
+#include "Modes.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+static const char* COLUMNS[] =
+{
+    "impl", "operation", "pattern", "size_byte", "iteration", "speed_GB_s", "errors", nullptr
+};
+
+static const char* PATTERN_NAMES[] = { "counter", "random" };
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+// No DMA, one thread. Each supported implementation fills and checks a
+// --size-max buffer, --bytes in total, and reports the speed of one core.
+// The buffer the vector code fills is checked with the scalar code and
+// the other way around, so the errors column must be 0.
+int Mode_Checker(DrvDMA*, const Options& aOptions, FILE* aOut)
+{
+    auto lPool = BufferPool::Create((ALLOC_PAGE == aOptions.mAlloc) ? ALLOC_PAGE : ALLOC_HUGE, aOptions.mNode, 1, aOptions.mSizeMax_byte);
+    if (nullptr == lPool)
+    {
+        return __LINE__;
+    }
+
+    auto lBuffer    = lPool->Acquire();
+    auto lIteration = Options_GetIteration(aOptions, aOptions.mSizeMax_byte, 1);
+    auto lPattern   = aOptions.mPattern;
+    auto lSeed      = aOptions.mSeed;
+    auto lSize_byte = aOptions.mSizeMax_byte;
+
+    Report lReport(aOut, aOptions.mFormat, COLUMNS);
+
+    for (unsigned int i = 0; i < PATTERN_IMPL_QTY; i++)
+    {
+        auto lImpl = static_cast<Pattern_Impl>(i);
+
+        if (!Pattern_Impl_IsSupported(lImpl))
+        {
+            continue;
+        }
+
+        fprintf(stderr, "%s - %u bytes - %u iterations\n", Pattern_Impl_GetName(lImpl), lSize_byte, lIteration);
+
+        // Fill
+        auto lBefore_ns = Clock_GetNow_ns();
+
+        for (unsigned int j = 0; j < lIteration; j++)
+        {
+            Pattern_Fill(lImpl, lPattern, lSeed, 0, lBuffer, lSize_byte);
+        }
+
+        auto lFill_ns = Clock_GetNow_ns() - lBefore_ns;
+
+        uint64_t lFillErrors = Pattern_Check(PATTERN_IMPL_SCALAR, lPattern, lSeed, 0, lBuffer, lSize_byte, nullptr, 0);
+
+        // Check
+        Pattern_Fill(PATTERN_IMPL_SCALAR, lPattern, lSeed, 0, lBuffer, lSize_byte);
+
+        uint64_t lCheckErrors = 0;
+
+        lBefore_ns = Clock_GetNow_ns();
+
+        for (unsigned int j = 0; j < lIteration; j++)
+        {
+            lCheckErrors += Pattern_Check(lImpl, lPattern, lSeed, 0, lBuffer, lSize_byte, nullptr, 0);
+        }
+
+        auto lCheck_ns = Clock_GetNow_ns() - lBefore_ns;
+
+        auto lTotal_byte = static_cast<double>(lSize_byte) * lIteration;
+
+        lReport.Row_Begin();
+        lReport.Value(Pattern_Impl_GetName(lImpl));
+        lReport.Value("fill");
+        lReport.Value(PATTERN_NAMES[lPattern]);
+        lReport.Value(static_cast<uint64_t>(lSize_byte));
+        lReport.Value(static_cast<uint64_t>(lIteration));
+        lReport.Value(lTotal_byte / lFill_ns);
+        lReport.Value(lFillErrors);
+        lReport.Row_End();
+
+        lReport.Row_Begin();
+        lReport.Value(Pattern_Impl_GetName(lImpl));
+        lReport.Value("check");
+        lReport.Value(PATTERN_NAMES[lPattern]);
+        lReport.Value(static_cast<uint64_t>(lSize_byte));
+        lReport.Value(static_cast<uint64_t>(lIteration));
+        lReport.Value(lTotal_byte / lCheck_ns);
+        lReport.Value(lCheckErrors);
+        lReport.Row_End();
+    }
+
+    lPool->Release(lBuffer);
+
+    delete lPool;
+
+    return 0;
+}
@@ -0,0 +1,61 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Clock.cpp
+
+#include "Component.h"
+
+// ===== C++ ================================================================
+#include <chrono>
+
+#ifdef _KMS_LINUX_
+    // ===== System =========================================================
+    #include <time.h>
+#endif
+
+// ===== Local ==============================================================
+#include "Clock.h"
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+uint64_t Clock_GetNow_ns()
+{
+    // steady_clock uses QueryPerformanceCounter on Windows and
+    // CLOCK_MONOTONIC on Linux.
+    auto lNow = std::chrono::steady_clock::now().time_since_epoch();
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(lNow).count();
+}
+
+uint64_t Clock_GetThreadCpu_ns()
+{
+    #ifdef _KMS_LINUX_
+        struct timespec lTS;
+
+        auto lRet = clock_gettime(CLOCK_THREAD_CPUTIME_ID, &lTS);
+        assert(0 == lRet);
+        (void)lRet;
+
+        return static_cast<uint64_t>(lTS.tv_sec) * 1000000000 + lTS.tv_nsec;
+    #endif
+
+    #ifdef _KMS_WINDOWS_
+        FILETIME lCreation;
+        FILETIME lExit;
+        FILETIME lKernel;
+        FILETIME lUser;
+
+        auto lRetB = GetThreadTimes(GetCurrentThread(), &lCreation, &lExit, &lKernel, &lUser);
+        assert(lRetB);
+        (void)lRetB;
+
+        // FILETIME counts 100 ns intervals.
+        uint64_t lResult = (static_cast<uint64_t>(lKernel.dwHighDateTime) << 32) | lKernel.dwLowDateTime;
+
+        lResult += (static_cast<uint64_t>(lUser.dwHighDateTime) << 32) | lUser.dwLowDateTime;
+
+        return lResult * 100;
+    #endif
+}
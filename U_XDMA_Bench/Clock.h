@@ -0,0 +1,17 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Clock.h
+
+#pragma once
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+// Return  A monotonic time stamp in ns. Only differences between two time
+//         stamps are meaningful.
+extern uint64_t Clock_GetNow_ns();
+
+// Return  The CPU time the calling thread used, user and kernel, in ns
+extern uint64_t Clock_GetThreadCpu_ns();
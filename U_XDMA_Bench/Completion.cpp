@@ -0,0 +1,153 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Completion.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "Channel.h"
+#include "Pipeline.h"
+#include "Report.h"
+
+#include "Modes.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+static const char* COLUMNS[] =
+{
+    "direction", "size_byte", "depth", "completion", "iteration", "speed_GB_s", "cpu_pct",
+    "latency_p50_us", "latency_p90_us", "latency_p99_us", "latency_p99_9_us", "latency_max_us",
+    nullptr
+};
+
+static const Completion COMPLETIONS[] = { COMPLETION_WAIT, COMPLETION_HYBRID, COMPLETION_POLL };
+
+static const char* COMPLETION_NAMES[COMPLETION_QTY] = { "hybrid", "poll", "wait" };
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static int Completion_Compare(DrvDMA* aDD, const Options& aOptions, bool aFromDevice, Report* aReport);
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+int Mode_Completion(DrvDMA* aDD, const Options& aOptions, FILE* aOut)
+{
+    int lResult = 0;
+
+    Report lReport(aOut, aOptions.mFormat, COLUMNS);
+
+    if (0 != (aOptions.mDirections & DIRECTION_H2C))
+    {
+        lResult = Completion_Compare(aDD, aOptions, false, &lReport);
+    }
+
+    if ((0 == lResult) && (0 != (aOptions.mDirections & DIRECTION_C2H)))
+    {
+        lResult = Completion_Compare(aDD, aOptions, true, &lReport);
+    }
+
+    return lResult;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+// The same workload runs with each completion policy. cpu_pct is the CPU
+// time of the pipeline thread over the run duration, 100 % meaning one
+// core kept busy.
+int Completion_Compare(DrvDMA* aDD, const Options& aOptions, bool aFromDevice, Report* aReport)
+{
+    auto lDirection = aFromDevice ? "C2H" : "H2C";
+
+    unsigned int lCI;
+
+    auto lRet = Channel_Open(aDD, aOptions, aFromDevice, 0, &lCI);
+    if (DrvDMA_OK != lRet)
+    {
+        return __LINE__;
+    }
+
+    Pipeline lPipeline(aDD, lCI, aFromDevice, aOptions.mHardwareAddress);
+
+    lPipeline.SetRegisters(Channel_GetRegisters(aDD, aOptions, aFromDevice, 0));
+
+    if (!lPipeline.Pool_Create(aOptions))
+    {
+        return __LINE__;
+    }
+
+    for (auto lSize_byte = aOptions.mSizeMin_byte; lSize_byte <= aOptions.mSizeMax_byte; lSize_byte *= 2)
+    {
+        for (unsigned int d = 0; d < aOptions.mDepthQty; d++)
+        {
+            for (auto lCompletion : COMPLETIONS)
+            {
+                Pipeline::Config lConfig;
+                Pipeline::Result lResult;
+                Pipeline::Trace  lTrace;
+
+                lConfig.mBufferQty       = aOptions.mDepths[d];
+                lConfig.mBufferSize_byte = lSize_byte;
+                lConfig.mCompletion      = lCompletion;
+                lConfig.mIntegrity       = nullptr;
+                lConfig.mIteration       = Options_GetIteration(aOptions, lSize_byte, lConfig.mBufferQty);
+                lConfig.mSpin_us         = aOptions.mSpin_us;
+                lConfig.mStop            = nullptr;
+                lConfig.mTrace           = &lTrace;
+
+                lTrace.mDone_ns  = new uint64_t[lConfig.mIteration];
+                lTrace.mStart_ns = new uint64_t[lConfig.mIteration];
+
+                fprintf(stderr, "%s - %u bytes - depth %u - %s - %u iterations\n", lDirection, lSize_byte, lConfig.mBufferQty, COMPLETION_NAMES[lCompletion], lConfig.mIteration);
+
+                lRet = lPipeline.Run(lConfig, &lResult);
+                if (DrvDMA_OK == lRet)
+                {
+                    auto lCount = lResult.mIteration;
+
+                    // Completion latency - From the Start call to the
+                    // return of the matching Wait
+                    auto lLatency_ns = new uint64_t[lCount];
+
+                    for (unsigned int i = 0; i < lCount; i++)
+                    {
+                        lLatency_ns[i] = lTrace.mDone_ns[i] - lTrace.mStart_ns[i];
+                    }
+
+                    aReport->Row_Begin();
+                    aReport->Value(lDirection);
+                    aReport->Value(static_cast<uint64_t>(lSize_byte));
+                    aReport->Value(static_cast<uint64_t>(lConfig.mBufferQty));
+                    aReport->Value(COMPLETION_NAMES[lResult.mCompletion]);
+                    aReport->Value(static_cast<uint64_t>(lCount));
+                    aReport->Value(Pipeline::GetSpeed_GB_s(lResult));
+                    aReport->Value(Pipeline::GetCpu_pct   (lResult));
+                    aReport->Percentiles_us(lLatency_ns, lCount);
+                    aReport->Row_End();
+
+                    delete[] lLatency_ns;
+                }
+
+                delete[] lTrace.mDone_ns;
+                delete[] lTrace.mStart_ns;
+
+                if (DrvDMA_OK != lRet)
+                {
+                    return __LINE__;
+                }
+            }
+        }
+
+        if (TRANSFER_SIZE_MAX_byte / 2 < lSize_byte)
+        {
+            break;
+        }
+    }
+
+    return 0;
+}
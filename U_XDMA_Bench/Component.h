@@ -0,0 +1,34 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Component.h
+
+#pragma once
+
+// ===== C ==================================================================
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ===== C++ ================================================================
+#include <atomic>
+
+#ifdef _KMS_WINDOWS_
+    // ===== Windows ========================================================
+    #include <Windows.h>
+#endif
+
+// ===== DrvDMA =============================================================
+#include <DrvDMA_U.h>
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+// CURRENT LIMITATION  DrvDMA currently limit transfer size to 32 MiB.
+#define TRANSFER_SIZE_MAX_byte (32 * 1024 * 1024)
+
+#define DIRECTION_H2C (0x1)
+#define DIRECTION_C2H (0x2)
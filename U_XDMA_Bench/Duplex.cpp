@@ -0,0 +1,140 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Duplex.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "Channel.h"
+#include "Group.h"
+#include "Report.h"
+
+#include "Modes.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+static const char* COLUMNS[] =
+{
+    "size_byte", "depth",
+    "h2c_alone_GB_s", "c2h_alone_GB_s",
+    "h2c_duplex_GB_s", "c2h_duplex_GB_s", "combined_GB_s",
+    "h2c_slowdown_pct", "c2h_slowdown_pct",
+    nullptr
+};
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static double GetSlowdown_pct(const Pipeline::Result& aAlone, const Pipeline::Result& aDuplex);
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+int Mode_Duplex(DrvDMA* aDD, const Options& aOptions, FILE* aOut)
+{
+    unsigned int lCI_C2H;
+    unsigned int lCI_H2C;
+
+    if ((DrvDMA_OK != Channel_Open(aDD, aOptions, false, 0, &lCI_H2C))
+     || (DrvDMA_OK != Channel_Open(aDD, aOptions, true , 0, &lCI_C2H)))
+    {
+        return __LINE__;
+    }
+
+    Pipeline lC2H(aDD, lCI_C2H, true , aOptions.mHardwareAddress);
+    Pipeline lH2C(aDD, lCI_H2C, false, aOptions.mHardwareAddress);
+
+    if ((!lC2H.Pool_Create(aOptions)) || (!lH2C.Pool_Create(aOptions)))
+    {
+        return __LINE__;
+    }
+
+    Report lReport(aOut, aOptions.mFormat, COLUMNS);
+
+    for (auto lSize_byte = aOptions.mSizeMin_byte; lSize_byte <= aOptions.mSizeMax_byte; lSize_byte *= 2)
+    {
+        for (unsigned int d = 0; d < aOptions.mDepthQty; d++)
+        {
+            Pipeline::Config lConfig;
+
+            lConfig.mBufferQty       = aOptions.mDepths[d];
+            lConfig.mBufferSize_byte = lSize_byte;
+            lConfig.mCompletion      = COMPLETION_WAIT;
+            lConfig.mIntegrity       = nullptr;
+            lConfig.mIteration       = Options_GetIteration(aOptions, lSize_byte, lConfig.mBufferQty);
+            lConfig.mSpin_us         = 0;
+            lConfig.mStop            = nullptr;
+            lConfig.mTrace           = nullptr;
+
+            fprintf(stderr, "%u bytes - depth %u - %u iterations\n", lSize_byte, lConfig.mBufferQty, lConfig.mIteration);
+
+            Pipeline* lPipelines[2] = { &lH2C, &lC2H };
+
+            // Each direction alone
+            Pipeline::Result lAlone[2];
+
+            for (unsigned int i = 0; i < 2; i++)
+            {
+                if (DrvDMA_OK != lPipelines[i]->Run(lConfig, lAlone + i))
+                {
+                    return __LINE__;
+                }
+            }
+
+            // Both directions at the same time
+            Pipeline::Result lDuplex[2];
+
+            if (!Group_Run(lPipelines, lConfig, 2, lDuplex))
+            {
+                return __LINE__;
+            }
+
+            auto& lR_C2H = lDuplex[1];
+            auto& lR_H2C = lDuplex[0];
+
+            Pipeline::Result lCombined;
+
+            Group_Combine(lDuplex, 2, &lCombined);
+
+            lReport.Row_Begin();
+            lReport.Value(static_cast<uint64_t>(lSize_byte));
+            lReport.Value(static_cast<uint64_t>(aOptions.mDepths[d]));
+            lReport.Value(Pipeline::GetSpeed_GB_s(lAlone[0]));
+            lReport.Value(Pipeline::GetSpeed_GB_s(lAlone[1]));
+            lReport.Value(Pipeline::GetSpeed_GB_s(lR_H2C));
+            lReport.Value(Pipeline::GetSpeed_GB_s(lR_C2H));
+            lReport.Value(Pipeline::GetSpeed_GB_s(lCombined));
+            lReport.Value(GetSlowdown_pct(lAlone[0], lR_H2C));
+            lReport.Value(GetSlowdown_pct(lAlone[1], lR_C2H));
+            lReport.Row_End();
+        }
+
+        if (TRANSFER_SIZE_MAX_byte / 2 < lSize_byte)
+        {
+            break;
+        }
+    }
+
+    return 0;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+// Return  How much slower, in %, the direction runs when the other one is
+//         running at the same time
+double GetSlowdown_pct(const Pipeline::Result& aAlone, const Pipeline::Result& aDuplex)
+{
+    double lResult = 0.0;
+
+    auto lAlone_GB_s = Pipeline::GetSpeed_GB_s(aAlone);
+    if (0.0 < lAlone_GB_s)
+    {
+        lResult = 100.0 * (lAlone_GB_s - Pipeline::GetSpeed_GB_s(aDuplex)) / lAlone_GB_s;
+    }
+
+    return lResult;
+}
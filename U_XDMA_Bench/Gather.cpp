@@ -0,0 +1,297 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Gather.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "BufferPool.h"
+#include "Channel.h"
+#include "Clock.h"
+#include "GatherTransfer.h"
+#include "Report.h"
+
+#include "Modes.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+static const char* COLUMNS[] =
+{
+    "direction", "size_byte", "fragments", "method", "iteration", "speed_GB_s", "transfer_us", "copy_us", nullptr
+};
+
+static const unsigned int FRAGMENT_QTYS[] = { 2, 8, 64 };
+
+#define FRAGMENT_QTY_MAX (64)
+
+// Data types
+// //////////////////////////////////////////////////////////////////////////
+
+typedef struct
+{
+    DrvDMA     * mDD;
+    unsigned int mCI;
+    bool         mFromDevice;
+    uint64_t     mHardwareAddress;
+    unsigned int mIteration;
+    void       * mStaging;
+
+    GatherTransfer::Fragment mFragments[FRAGMENT_QTY_MAX];
+    unsigned int             mFragmentQty;
+    unsigned int             mSize_byte;
+}
+Context;
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static int Gather_Compare(DrvDMA* aDD, const Options& aOptions, bool aFromDevice, Report* aReport);
+
+static DrvDMA_Result Run_Copy  (const Context& aContext, uint64_t* aDuration_ns, uint64_t* aCopy_ns);
+static DrvDMA_Result Run_Gather(const Context& aContext, GatherTransfer* aGT, uint64_t* aDuration_ns);
+
+static void Row(Report* aReport, const Context& aContext, const char* aMethod, uint64_t aDuration_ns, uint64_t aCopy_ns);
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+int Mode_Gather(DrvDMA* aDD, const Options& aOptions, FILE* aOut)
+{
+    int lResult = 0;
+
+    Report lReport(aOut, aOptions.mFormat, COLUMNS);
+
+    if (0 != (aOptions.mDirections & DIRECTION_H2C))
+    {
+        lResult = Gather_Compare(aDD, aOptions, false, &lReport);
+    }
+
+    if ((0 == lResult) && (0 != (aOptions.mDirections & DIRECTION_C2H)))
+    {
+        lResult = Gather_Compare(aDD, aOptions, true, &lReport);
+    }
+
+    return lResult;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+// One packet in flight, as the send path of an application. The copy
+// method gathers the fragments in a staging buffer and starts one
+// transfer (H2C), or starts one transfer and scatters the staging buffer
+// to the fragments (C2H). The gather method starts one transfer per
+// fragment. The fragments are separated by gaps of their own size, so no
+// two are contiguous.
+int Gather_Compare(DrvDMA* aDD, const Options& aOptions, bool aFromDevice, Report* aReport)
+{
+    auto lDirection = aFromDevice ? "C2H" : "H2C";
+
+    Context lContext;
+
+    memset(&lContext, 0, sizeof(lContext));
+
+    lContext.mDD              = aDD;
+    lContext.mFromDevice      = aFromDevice;
+    lContext.mHardwareAddress = aOptions.mHardwareAddress;
+
+    auto lRet = Channel_Open(aDD, aOptions, aFromDevice, 0, &lContext.mCI);
+    if (DrvDMA_OK != lRet)
+    {
+        return __LINE__;
+    }
+
+    // ALLOC_LEGACY would allocate the buffers at each run, what this mode
+    // does not measure.
+    auto lPool = BufferPool::Create((ALLOC_PAGE == aOptions.mAlloc) ? ALLOC_PAGE : ALLOC_HUGE, aOptions.mNode, 2, 2 * aOptions.mSizeMax_byte);
+    if (nullptr == lPool)
+    {
+        return __LINE__;
+    }
+
+    auto lFragments = reinterpret_cast<uint8_t*>(lPool->Acquire());
+
+    lContext.mStaging = lPool->Acquire();
+
+    int lResult = 0;
+
+    GatherTransfer lGT(aDD, lContext.mCI, aFromDevice, FRAGMENT_QTY_MAX);
+
+    for (auto lSize_byte = aOptions.mSizeMin_byte; (0 == lResult) && (lSize_byte <= aOptions.mSizeMax_byte); lSize_byte *= 2)
+    {
+        lContext.mIteration = Options_GetIteration(aOptions, lSize_byte, 1);
+        lContext.mSize_byte = lSize_byte;
+
+        for (auto lQty : FRAGMENT_QTYS)
+        {
+            if (lSize_byte < lQty)
+            {
+                continue;
+            }
+
+            // The last fragment also takes the remainder.
+            auto lFragment_byte = lSize_byte / lQty;
+
+            for (unsigned int i = 0; i < lQty; i++)
+            {
+                lContext.mFragments[i].mBase      = lFragments + 2 * i * lFragment_byte;
+                lContext.mFragments[i].mSize_byte = lFragment_byte;
+            }
+
+            lContext.mFragments[lQty - 1].mSize_byte += lSize_byte % lQty;
+            lContext.mFragmentQty = lQty;
+
+            fprintf(stderr, "%s - %u bytes - %u fragments - %u iterations\n", lDirection, lSize_byte, lQty, lContext.mIteration);
+
+            uint64_t lCopy_ns;
+            uint64_t lDuration_ns;
+
+            lRet = Run_Copy(lContext, &lDuration_ns, &lCopy_ns);
+            if (DrvDMA_OK != lRet)
+            {
+                lResult = __LINE__;
+                break;
+            }
+
+            Row(aReport, lContext, "copy", lDuration_ns, lCopy_ns);
+
+            lRet = Run_Gather(lContext, &lGT, &lDuration_ns);
+            if (DrvDMA_OK != lRet)
+            {
+                lResult = __LINE__;
+                break;
+            }
+
+            Row(aReport, lContext, "gather", lDuration_ns, 0);
+        }
+
+        if (TRANSFER_SIZE_MAX_byte / 2 < lSize_byte)
+        {
+            break;
+        }
+    }
+
+    lPool->Release(lContext.mStaging);
+    lPool->Release(lFragments);
+
+    delete lPool;
+
+    return lResult;
+}
+
+DrvDMA_Result Run_Copy(const Context& aContext, uint64_t* aDuration_ns, uint64_t* aCopy_ns)
+{
+    assert(nullptr != aDuration_ns);
+    assert(nullptr != aCopy_ns);
+
+    auto lResult  = DrvDMA_OK;
+    auto lStaging = reinterpret_cast<uint8_t*>(aContext.mStaging);
+
+    uint64_t lCopy_ns = 0;
+
+    auto lStart_ns = Clock_GetNow_ns();
+
+    for (unsigned int i = 0; (DrvDMA_OK == lResult) && (i < aContext.mIteration); i++)
+    {
+        DrvDMA_Transfer_Status lStatus;
+
+        if (!aContext.mFromDevice)
+        {
+            unsigned int lOffset_byte = 0;
+
+            auto lBefore_ns = Clock_GetNow_ns();
+
+            for (unsigned int j = 0; j < aContext.mFragmentQty; j++)
+            {
+                auto& lF = aContext.mFragments[j];
+
+                memcpy(lStaging + lOffset_byte, lF.mBase, lF.mSize_byte);
+
+                lOffset_byte += lF.mSize_byte;
+            }
+
+            lCopy_ns += Clock_GetNow_ns() - lBefore_ns;
+        }
+
+        lResult = aContext.mDD->Start(aContext.mCI, aContext.mFromDevice, lStaging, 0, aContext.mHardwareAddress, aContext.mSize_byte, &lStatus);
+        if (DrvDMA_OK_PENDING != lResult)
+        {
+            fprintf(stderr, "ERROR  DrvDMA::Start failed - %s\n", DrvDMA::GetResultName(lResult));
+            break;
+        }
+
+        lResult = aContext.mDD->Wait(&lStatus);
+        if (DrvDMA_OK != lResult)
+        {
+            fprintf(stderr, "ERROR  DrvDMA::Wait failed - %s\n", DrvDMA::GetResultName(lResult));
+            break;
+        }
+
+        if (aContext.mFromDevice)
+        {
+            unsigned int lOffset_byte = 0;
+
+            auto lBefore_ns = Clock_GetNow_ns();
+
+            for (unsigned int j = 0; j < aContext.mFragmentQty; j++)
+            {
+                auto& lF = aContext.mFragments[j];
+
+                memcpy(lF.mBase, lStaging + lOffset_byte, lF.mSize_byte);
+
+                lOffset_byte += lF.mSize_byte;
+            }
+
+            lCopy_ns += Clock_GetNow_ns() - lBefore_ns;
+        }
+    }
+
+    *aCopy_ns     = lCopy_ns;
+    *aDuration_ns = Clock_GetNow_ns() - lStart_ns;
+
+    return lResult;
+}
+
+DrvDMA_Result Run_Gather(const Context& aContext, GatherTransfer* aGT, uint64_t* aDuration_ns)
+{
+    assert(nullptr != aGT);
+    assert(nullptr != aDuration_ns);
+
+    auto lResult = DrvDMA_OK;
+
+    auto lStart_ns = Clock_GetNow_ns();
+
+    for (unsigned int i = 0; (DrvDMA_OK == lResult) && (i < aContext.mIteration); i++)
+    {
+        lResult = aGT->Start(aContext.mFragments, aContext.mFragmentQty, aContext.mHardwareAddress);
+
+        auto lRet = aGT->Wait();
+        if (DrvDMA_OK == lResult)
+        {
+            lResult = lRet;
+        }
+    }
+
+    *aDuration_ns = Clock_GetNow_ns() - lStart_ns;
+
+    return lResult;
+}
+
+void Row(Report* aReport, const Context& aContext, const char* aMethod, uint64_t aDuration_ns, uint64_t aCopy_ns)
+{
+    double lTotal_byte = static_cast<double>(aContext.mSize_byte) * aContext.mIteration;
+
+    aReport->Row_Begin();
+    aReport->Value(aContext.mFromDevice ? "C2H" : "H2C");
+    aReport->Value(static_cast<uint64_t>(aContext.mSize_byte));
+    aReport->Value(static_cast<uint64_t>(aContext.mFragmentQty));
+    aReport->Value(aMethod);
+    aReport->Value(static_cast<uint64_t>(aContext.mIteration));
+    aReport->Value(lTotal_byte / aDuration_ns);
+    aReport->Value(static_cast<double>(aDuration_ns) / aContext.mIteration / 1000.0);
+    aReport->Value(static_cast<double>(aCopy_ns   ) / aContext.mIteration / 1000.0);
+    aReport->Row_End();
+}
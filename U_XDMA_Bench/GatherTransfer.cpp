@@ -0,0 +1,85 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/GatherTransfer.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "GatherTransfer.h"
+
+// Public
+// //////////////////////////////////////////////////////////////////////////
+
+GatherTransfer::GatherTransfer(DrvDMA* aDD, unsigned int aCI, bool aFromDevice, unsigned int aFragmentMax)
+    : mDD(aDD), mCI(aCI), mFromDevice(aFromDevice), mFragmentMax(aFragmentMax), mPending(0), mResult(DrvDMA_OK)
+{
+    assert(nullptr != aDD);
+    assert(0 < aFragmentMax);
+
+    mStatus = new DrvDMA_Transfer_Status[aFragmentMax];
+}
+
+GatherTransfer::~GatherTransfer()
+{
+    if (0 < mPending)
+    {
+        Wait();
+    }
+
+    delete[] mStatus;
+}
+
+DrvDMA_Result GatherTransfer::Start(const Fragment* aFragments, unsigned int aCount, uint64_t aHardwareAddress)
+{
+    assert(nullptr != aFragments);
+    assert(0 < aCount);
+    assert(mFragmentMax >= aCount);
+    assert(0 == mPending);
+
+    auto lHardwareAddress = aHardwareAddress;
+
+    mResult = DrvDMA_OK;
+
+    for (unsigned int i = 0; i < aCount; i++)
+    {
+        auto& lF = aFragments[i];
+
+        assert(nullptr != lF.mBase);
+        assert(0 < lF.mSize_byte);
+        assert(TRANSFER_SIZE_MAX_byte >= lF.mSize_byte);
+
+        auto lRet = mDD->Start(mCI, mFromDevice, lF.mBase, 0, lHardwareAddress, lF.mSize_byte, mStatus + i);
+        if (DrvDMA_OK_PENDING != lRet)
+        {
+            fprintf(stderr, "ERROR  DrvDMA::Start failed - %s\n", DrvDMA::GetResultName(lRet));
+            mResult = lRet;
+            break;
+        }
+
+        lHardwareAddress += lF.mSize_byte;
+        mPending++;
+    }
+
+    return mResult;
+}
+
+DrvDMA_Result GatherTransfer::Wait()
+{
+    // The fragments complete in order, the last one completes the
+    // transfer. Each still needs its Wait to release its status.
+    for (unsigned int i = 0; i < mPending; i++)
+    {
+        auto lRet = mDD->Wait(mStatus + i);
+        if ((DrvDMA_OK != lRet) && (DrvDMA_OK == mResult))
+        {
+            fprintf(stderr, "ERROR  DrvDMA::Wait failed - %s\n", DrvDMA::GetResultName(lRet));
+            mResult = lRet;
+        }
+    }
+
+    mPending = 0;
+
+    return mResult;
+}
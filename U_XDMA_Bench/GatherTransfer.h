@@ -0,0 +1,69 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/GatherTransfer.h
+
+#pragma once
+
+// Vectored transfers. A list of host fragments goes to (H2C) or comes
+// from (C2H) one contiguous region of the internal AXI bus, without
+// copying the fragments into a staging buffer.
+//
+// DrvDMA::Start maps one buffer, so each fragment is a DrvDMA transfer.
+// Start queues all of them back to back on the channel, the hardware
+// address advancing by the fragment size, and Wait completes the vectored
+// transfer when the last fragment completes. An instance is not thread
+// safe.
+class GatherTransfer
+{
+
+public:
+
+    typedef struct
+    {
+        void       * mBase;
+        unsigned int mSize_byte;
+    }
+    Fragment;
+
+    // aDD           The DrvDMA instance
+    // aCI           The logical index of the configured channel
+    // aFromDevice   true for C2H, false for H2C
+    // aFragmentMax  The maximum number of fragments of a transfer
+    GatherTransfer(DrvDMA* aDD, unsigned int aCI, bool aFromDevice, unsigned int aFragmentMax);
+
+    ~GatherTransfer();
+
+    // aFragments        The fragments, each TRANSFER_SIZE_MAX_byte or less
+    // aCount            The number of fragments
+    // aHardwareAddress  The address of the first fragment on the internal
+    //                   AXI bus
+    //
+    // Return
+    //  DrvDMA_OK
+    //  ...        See DrvDMA::Start
+    DrvDMA_Result Start(const Fragment* aFragments, unsigned int aCount, uint64_t aHardwareAddress);
+
+    // Wait for the completion of all the fragments started by Start. Wait
+    // must be called even when Start fails.
+    //
+    // Return
+    //  DrvDMA_OK
+    //  ...        See DrvDMA::Start and DrvDMA::Wait
+    DrvDMA_Result Wait();
+
+private:
+
+    DrvDMA     * mDD;
+    unsigned int mCI;
+    bool         mFromDevice;
+    unsigned int mFragmentMax;
+    unsigned int mPending;
+
+    // The first error of the current transfer
+    DrvDMA_Result mResult;
+
+    DrvDMA_Transfer_Status* mStatus;
+
+};
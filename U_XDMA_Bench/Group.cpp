@@ -0,0 +1,135 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Group.cpp
+
+#include "Component.h"
+
+// ===== C++ ================================================================
+#include <thread>
+
+// ===== Local ==============================================================
+#include "Group.h"
+
+// Data types
+// //////////////////////////////////////////////////////////////////////////
+
+typedef struct
+{
+    Pipeline        * mPipeline;
+    Pipeline::Config  mConfig;
+    Pipeline::Result* mResult;
+    DrvDMA_Result     mRet;
+
+    const std::atomic<bool>* mGo;
+    std::atomic<bool>      * mStop;
+}
+Member;
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static void Member_Run(Member* aMember);
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+void Group_Combine(const Pipeline::Result* aResults, unsigned int aCount, Pipeline::Result* aOut)
+{
+    assert(nullptr != aResults);
+    assert(0 < aCount);
+    assert(nullptr != aOut);
+
+    memset(aOut, 0, sizeof(*aOut));
+
+    uint64_t lStop_ns = 0;
+
+    aOut->mCompletion = aResults[0].mCompletion;
+    aOut->mStart_ns   = UINT64_MAX;
+
+    for (unsigned int i = 0; i < aCount; i++)
+    {
+        auto& lR = aResults[i];
+
+        if (aOut->mStart_ns > lR.mStart_ns)
+        {
+            aOut->mStart_ns = lR.mStart_ns;
+        }
+
+        if (lStop_ns < lR.mStart_ns + lR.mDuration_ns)
+        {
+            lStop_ns = lR.mStart_ns + lR.mDuration_ns;
+        }
+
+        aOut->mCpu_ns        += lR.mCpu_ns;
+        aOut->mIteration     += lR.mIteration;
+        aOut->mStartTotal_ns += lR.mStartTotal_ns;
+        aOut->mTotal_byte    += lR.mTotal_byte;
+    }
+
+    aOut->mDuration_ns = lStop_ns - aOut->mStart_ns;
+}
+
+bool Group_Run(Pipeline** aPipelines, const Pipeline::Config& aConfig, unsigned int aCount, Pipeline::Result* aResults)
+{
+    assert(nullptr != aPipelines);
+    assert(nullptr == aConfig.mStop);
+    assert(0 < aCount);
+    assert(nullptr != aResults);
+
+    std::atomic<bool> lGo  (false);
+    std::atomic<bool> lStop(false);
+
+    auto lMembers = new Member     [aCount];
+    auto lThreads = new std::thread[aCount];
+
+    for (unsigned int i = 0; i < aCount; i++)
+    {
+        auto& lM = lMembers[i];
+
+        lM.mConfig   = aConfig;
+        lM.mGo       = &lGo;
+        lM.mPipeline = aPipelines[i];
+        lM.mResult   = aResults + i;
+        lM.mStop     = &lStop;
+
+        lM.mConfig.mStop = &lStop;
+
+        lThreads[i] = std::thread(Member_Run, lMembers + i);
+    }
+
+    // All the threads are created, release them together.
+    lGo = true;
+
+    bool lResult = true;
+
+    for (unsigned int i = 0; i < aCount; i++)
+    {
+        lThreads[i].join();
+
+        if (DrvDMA_OK != lMembers[i].mRet)
+        {
+            lResult = false;
+        }
+    }
+
+    delete[] lMembers;
+    delete[] lThreads;
+
+    return lResult;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+void Member_Run(Member* aMember)
+{
+    while (!aMember->mGo->load())
+    {
+    }
+
+    aMember->mRet = aMember->mPipeline->Run(aMember->mConfig, aMember->mResult);
+
+    aMember->mStop->store(true);
+}
@@ -0,0 +1,33 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Group.h
+
+#pragma once
+
+// ===== Local ==============================================================
+#include "Pipeline.h"
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+// Combine the results of pipelines run at the same time. The duration goes
+// from the first start to the last stop.
+//
+// aResults  The results to combine
+// aCount    The number of results
+// aOut [---;-W-] The combined result
+extern void Group_Combine(const Pipeline::Result* aResults, unsigned int aCount, Pipeline::Result* aOut);
+
+// Run pipelines at the same time, one thread each. The first pipeline to
+// complete its iterations stops the others, so all the results cover the
+// same period.
+//
+// aPipelines  The pipelines to run
+// aConfig     The configuration of each run. mStop must be nullptr.
+// aCount      The number of pipelines
+// aResults [---;-W-] The result of each pipeline
+//
+// Return  false if at least one pipeline failed
+extern bool Group_Run(Pipeline** aPipelines, const Pipeline::Config& aConfig, unsigned int aCount, Pipeline::Result* aResults);
@@ -0,0 +1,175 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Integrity.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "Channel.h"
+#include "Pipeline.h"
+#include "Report.h"
+
+#include "Modes.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+static const char* COLUMNS[] =
+{
+    "direction", "size_byte", "depth", "pattern", "iteration", "speed_GB_s", "pattern_GB_s", "errors", nullptr
+};
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static int Measure(Pipeline* aPipeline, const Pipeline::Config& aConfig, const char* aDirection, const char* aPattern, Report* aReport);
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+// The H2C transfers write the pattern at --hw-address and the C2H
+// transfers read it back, so the design must map memory there. Each size
+// and depth is measured without and with the pattern, to show what the
+// generation and the check cost.
+int Mode_Integrity(DrvDMA* aDD, const Options& aOptions, FILE* aOut)
+{
+    Pipeline* lPipelines[2] = { nullptr, nullptr };
+    int       lResult       = 0;
+
+    for (unsigned int i = 0; (0 == lResult) && (i < 2); i++)
+    {
+        auto lFromDevice = (1 == i);
+
+        if (0 != (aOptions.mDirections & (lFromDevice ? DIRECTION_C2H : DIRECTION_H2C)))
+        {
+            unsigned int lCI;
+
+            if (DrvDMA_OK != Channel_Open(aDD, aOptions, lFromDevice, 0, &lCI))
+            {
+                lResult = __LINE__;
+                break;
+            }
+
+            lPipelines[i] = new Pipeline(aDD, lCI, lFromDevice, aOptions.mHardwareAddress);
+
+            if (!lPipelines[i]->Pool_Create(aOptions))
+            {
+                lResult = __LINE__;
+            }
+        }
+    }
+
+    Report lReport(aOut, aOptions.mFormat, COLUMNS);
+
+    Pipeline::Integrity lIntegrity;
+
+    lIntegrity.mImpl    = Pattern_Impl_Best();
+    lIntegrity.mPattern = aOptions.mPattern;
+    lIntegrity.mSeed    = aOptions.mSeed;
+
+    fprintf(stderr, "Pattern implementation - %s\n", Pattern_Impl_GetName(lIntegrity.mImpl));
+
+    for (auto lSize_byte = aOptions.mSizeMin_byte; (0 == lResult) && (lSize_byte <= aOptions.mSizeMax_byte); lSize_byte *= 2)
+    {
+        for (unsigned int d = 0; (0 == lResult) && (d < aOptions.mDepthQty); d++)
+        {
+            Pipeline::Config lConfig;
+
+            lConfig.mBufferQty       = aOptions.mDepths[d];
+            lConfig.mBufferSize_byte = lSize_byte;
+            lConfig.mCompletion      = COMPLETION_WAIT;
+            lConfig.mIteration       = Options_GetIteration(aOptions, lSize_byte, lConfig.mBufferQty);
+            lConfig.mSpin_us         = 0;
+            lConfig.mStop            = nullptr;
+            lConfig.mTrace           = nullptr;
+
+            fprintf(stderr, "%u bytes - depth %u - %u iterations\n", lSize_byte, lConfig.mBufferQty, lConfig.mIteration);
+
+            // The H2C transfers run first, so the C2H transfers find the
+            // pattern of the same size in the device memory.
+            for (unsigned int i = 0; (0 == lResult) && (i < 2); i++)
+            {
+                if (nullptr != lPipelines[i])
+                {
+                    auto lDirection = (1 == i) ? "C2H" : "H2C";
+
+                    lConfig.mIntegrity = nullptr;
+
+                    lResult = Measure(lPipelines[i], lConfig, lDirection, "none", &lReport);
+                    if (0 == lResult)
+                    {
+                        lConfig.mIntegrity = &lIntegrity;
+
+                        lResult = Measure(lPipelines[i], lConfig, lDirection, (1 == i) ? "check" : "fill", &lReport);
+                    }
+                }
+            }
+        }
+
+        if (TRANSFER_SIZE_MAX_byte / 2 < lSize_byte)
+        {
+            break;
+        }
+    }
+
+    for (unsigned int i = 0; i < 2; i++)
+    {
+        if (nullptr != lPipelines[i])
+        {
+            delete lPipelines[i];
+        }
+    }
+
+    return lResult;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+int Measure(Pipeline* aPipeline, const Pipeline::Config& aConfig, const char* aDirection, const char* aPattern, Report* aReport)
+{
+    Pipeline::Result lResult;
+
+    if (DrvDMA_OK != aPipeline->Run(aConfig, &lResult))
+    {
+        return __LINE__;
+    }
+
+    auto lI = aConfig.mIntegrity;
+
+    double   lPattern_GB_s = 0.0;
+    uint64_t lErrors       = 0;
+
+    if (nullptr != lI)
+    {
+        for (unsigned int i = 0; i < lI->mErrorQty; i++)
+        {
+            auto& lE = lI->mErrors[i];
+
+            fprintf(stderr, "ERROR  Data mismatch at offset 0x%08llx - Expected 0x%08x - Actual 0x%08x\n",
+                static_cast<unsigned long long>(lE.mOffset_byte), lE.mExpected, lE.mActual);
+        }
+
+        if (0 < lI->mPattern_ns)
+        {
+            lPattern_GB_s = static_cast<double>(lResult.mTotal_byte) / lI->mPattern_ns;
+        }
+
+        lErrors = lI->mErrorCount;
+    }
+
+    aReport->Row_Begin();
+    aReport->Value(aDirection);
+    aReport->Value(static_cast<uint64_t>(aConfig.mBufferSize_byte));
+    aReport->Value(static_cast<uint64_t>(aConfig.mBufferQty));
+    aReport->Value(aPattern);
+    aReport->Value(static_cast<uint64_t>(lResult.mIteration));
+    aReport->Value(Pipeline::GetSpeed_GB_s(lResult));
+    aReport->Value(lPattern_GB_s);
+    aReport->Value(lErrors);
+    aReport->Row_End();
+
+    return 0;
+}
@@ -0,0 +1,224 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Large.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "BufferPool.h"
+#include "Channel.h"
+#include "Clock.h"
+#include "LargeTransfer.h"
+#include "Pipeline.h"
+#include "Report.h"
+
+#include "Modes.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+static const char* COLUMNS[] =
+{
+    "direction", "method", "size_byte", "chunk_byte", "depth", "iteration", "duration_s", "speed_GB_s", "vs_pipeline", nullptr
+};
+
+// Two frames in flight, as a capture application filling one frame while
+// the other is processed.
+#define FRAME_QTY (2)
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static int Large(DrvDMA* aDD, const Options& aOptions, bool aFromDevice, Report* aReport);
+
+static DrvDMA_Result Run(LargeTransfer* aLT, BufferPool* aPool, uint64_t aHardwareAddress, unsigned int aSize_byte, unsigned int aIteration, uint64_t* aDuration_ns);
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+int Mode_Large(DrvDMA* aDD, const Options& aOptions, FILE* aOut)
+{
+    int lResult = 0;
+
+    Report lReport(aOut, aOptions.mFormat, COLUMNS);
+
+    if (0 != (aOptions.mDirections & DIRECTION_H2C))
+    {
+        lResult = Large(aDD, aOptions, false, &lReport);
+    }
+
+    if ((0 == lResult) && (0 != (aOptions.mDirections & DIRECTION_C2H)))
+    {
+        lResult = Large(aDD, aOptions, true, &lReport);
+    }
+
+    return lResult;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+// The LargeTransfer instance moves FRAME_QTY frames of --large-size bytes
+// in chunks of --size-max bytes. The Pipeline moves the same number of
+// bytes with hand-written --size-max transfers. Both keep the same number
+// of transfers in flight.
+int Large(DrvDMA* aDD, const Options& aOptions, bool aFromDevice, Report* aReport)
+{
+    auto lDirection = aFromDevice ? "C2H" : "H2C";
+
+    unsigned int lCI;
+
+    auto lRet = Channel_Open(aDD, aOptions, aFromDevice, 0, &lCI);
+    if (DrvDMA_OK != lRet)
+    {
+        return __LINE__;
+    }
+
+    // ALLOC_LEGACY would allocate the frames at each run, what this mode
+    // does not measure.
+    auto lFrames = BufferPool::Create((ALLOC_PAGE == aOptions.mAlloc) ? ALLOC_PAGE : ALLOC_HUGE, aOptions.mNode, FRAME_QTY, aOptions.mLargeSize_byte);
+    if (nullptr == lFrames)
+    {
+        return __LINE__;
+    }
+
+    int lResult = 0;
+
+    Pipeline lPipeline(aDD, lCI, aFromDevice, aOptions.mHardwareAddress);
+
+    if (!lPipeline.Pool_Create(aOptions))
+    {
+        lResult = __LINE__;
+    }
+
+    auto lChunk_byte = aOptions.mSizeMax_byte;
+    auto lChunkQty   = (aOptions.mLargeSize_byte + lChunk_byte - 1) / lChunk_byte;
+    auto lIteration  = Options_GetIteration(aOptions, aOptions.mLargeSize_byte, FRAME_QTY);
+
+    for (unsigned int d = 0; (0 == lResult) && (d < aOptions.mDepthQty); d++)
+    {
+        auto lDepth = aOptions.mDepths[d];
+
+        Pipeline::Config lConfig;
+        Pipeline::Result lPR;
+
+        lConfig.mBufferQty       = lDepth;
+        lConfig.mBufferSize_byte = lChunk_byte;
+        lConfig.mCompletion      = COMPLETION_WAIT;
+        lConfig.mIntegrity       = nullptr;
+        lConfig.mIteration       = lChunkQty * lIteration;
+        lConfig.mSpin_us         = 0;
+        lConfig.mStop            = nullptr;
+        lConfig.mTrace           = nullptr;
+
+        fprintf(stderr, "%s - %u bytes - depth %u - %u iterations\n", lDirection, lChunk_byte, lDepth, lConfig.mIteration);
+
+        lRet = lPipeline.Run(lConfig, &lPR);
+        if (DrvDMA_OK != lRet)
+        {
+            lResult = __LINE__;
+            break;
+        }
+
+        fprintf(stderr, "%s - %u bytes in %u chunks - depth %u - %u iterations\n", lDirection, aOptions.mLargeSize_byte, lChunkQty, lDepth, lIteration);
+
+        uint64_t lDuration_ns;
+
+        {
+            LargeTransfer lLT(aDD, lCI, aFromDevice, lDepth, lChunk_byte);
+
+            lRet = Run(&lLT, lFrames, aOptions.mHardwareAddress, aOptions.mLargeSize_byte, lIteration, &lDuration_ns);
+        }
+
+        if (DrvDMA_OK != lRet)
+        {
+            lResult = __LINE__;
+            break;
+        }
+
+        auto lPipeline_GB_s = Pipeline::GetSpeed_GB_s(lPR);
+        auto lLarge_GB_s    = static_cast<double>(aOptions.mLargeSize_byte) * lIteration / lDuration_ns;
+
+        aReport->Row_Begin();
+        aReport->Value(lDirection);
+        aReport->Value("pipeline");
+        aReport->Value(static_cast<uint64_t>(lChunk_byte));
+        aReport->Value(static_cast<uint64_t>(lChunk_byte));
+        aReport->Value(static_cast<uint64_t>(lDepth));
+        aReport->Value(static_cast<uint64_t>(lPR.mIteration));
+        aReport->Value(static_cast<double>(lPR.mDuration_ns) / 1000000000.0);
+        aReport->Value(lPipeline_GB_s);
+        aReport->Value(1.0);
+        aReport->Row_End();
+
+        aReport->Row_Begin();
+        aReport->Value(lDirection);
+        aReport->Value("large");
+        aReport->Value(static_cast<uint64_t>(aOptions.mLargeSize_byte));
+        aReport->Value(static_cast<uint64_t>(lChunk_byte));
+        aReport->Value(static_cast<uint64_t>(lDepth));
+        aReport->Value(static_cast<uint64_t>(lIteration));
+        aReport->Value(static_cast<double>(lDuration_ns) / 1000000000.0);
+        aReport->Value(lLarge_GB_s);
+        aReport->Value(lLarge_GB_s / lPipeline_GB_s);
+        aReport->Row_End();
+    }
+
+    delete lFrames;
+
+    return lResult;
+}
+
+// Start the FRAME_QTY frames, then wait the oldest and start it again
+// until aIteration frames are transfered. The buffers of the pool are
+// rounded up to the page size, each frame transfers aSize_byte of them.
+DrvDMA_Result Run(LargeTransfer* aLT, BufferPool* aPool, uint64_t aHardwareAddress, unsigned int aSize_byte, unsigned int aIteration, uint64_t* aDuration_ns)
+{
+    assert(nullptr != aLT);
+    assert(nullptr != aPool);
+    assert(aPool->GetBufferSize() >= aSize_byte);
+    assert(FRAME_QTY <= aIteration);
+    assert(nullptr != aDuration_ns);
+
+    void* lFrames[FRAME_QTY];
+
+    for (unsigned int i = 0; i < FRAME_QTY; i++)
+    {
+        lFrames[i] = aPool->Acquire();
+    }
+
+    auto lResult = DrvDMA_OK;
+    auto lStart_ns = Clock_GetNow_ns();
+    unsigned int lStarted = 0;
+
+    for (; (DrvDMA_OK == lResult) && (lStarted < FRAME_QTY); lStarted++)
+    {
+        lResult = aLT->Start(lFrames[lStarted], aHardwareAddress, aSize_byte);
+    }
+
+    for (unsigned int lDone = 0; lDone < lStarted; lDone++)
+    {
+        auto lRet = aLT->Wait();
+        if (DrvDMA_OK == lResult)
+        {
+            lResult = lRet;
+        }
+
+        if ((DrvDMA_OK == lResult) && (lStarted < aIteration))
+        {
+            lResult = aLT->Start(lFrames[lStarted % FRAME_QTY], aHardwareAddress, aSize_byte);
+            lStarted++;
+        }
+    }
+
+    *aDuration_ns = Clock_GetNow_ns() - lStart_ns;
+
+    for (unsigned int i = 0; i < FRAME_QTY; i++)
+    {
+        aPool->Release(lFrames[i]);
+    }
+
+    return lResult;
+}
@@ -0,0 +1,177 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/LargeTransfer.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "LargeTransfer.h"
+
+// Public
+// //////////////////////////////////////////////////////////////////////////
+
+LargeTransfer::LargeTransfer(DrvDMA* aDD, unsigned int aCI, bool aFromDevice, unsigned int aChunkQty, unsigned int aChunkSize_byte)
+    : mChunkHead(0)
+    , mChunkPending(0)
+    , mChunkQty(aChunkQty)
+    , mChunkSize_byte(aChunkSize_byte)
+    , mDD(aDD)
+    , mCI(aCI)
+    , mFromDevice(aFromDevice)
+    , mResult(DrvDMA_OK)
+    , mTransferHead(0)
+    , mTransferCount(0)
+{
+    assert(nullptr != aDD);
+    assert(0 < aChunkQty);
+    assert(0 < aChunkSize_byte);
+    assert(TRANSFER_SIZE_MAX_byte >= aChunkSize_byte);
+
+    mChunks = new Chunk[aChunkQty];
+}
+
+LargeTransfer::~LargeTransfer()
+{
+    while (0 < mTransferCount)
+    {
+        Wait();
+    }
+
+    delete[] mChunks;
+}
+
+DrvDMA_Result LargeTransfer::Start(void* aBuffer, uint64_t aHardwareAddress, uint64_t aSize_byte)
+{
+    assert(nullptr != aBuffer);
+    assert(0 < aSize_byte);
+    assert(TRANSFER_QTY_MAX > mTransferCount);
+
+    auto lIndex = (mTransferHead + mTransferCount) % TRANSFER_QTY_MAX;
+    auto lT     = mTransfers + lIndex;
+
+    lT->mBuffer          = reinterpret_cast<uint8_t*>(aBuffer);
+    lT->mHardwareAddress = aHardwareAddress;
+    lT->mNext_byte       = 0;
+    lT->mPending         = 0;
+    lT->mSize_byte       = aSize_byte;
+
+    mTransferCount++;
+
+    Fill();
+
+    return mResult;
+}
+
+DrvDMA_Result LargeTransfer::Wait()
+{
+    assert(0 < mTransferCount);
+
+    auto lT = mTransfers + mTransferHead;
+
+    // The chunks complete in order, so the chunks of the oldest logical
+    // transfer are the first in flight.
+    while (0 < lT->mPending)
+    {
+        auto lC = mChunks + mChunkHead;
+        assert(mTransferHead == lC->mOwner);
+
+        auto lRet = mDD->Wait(&lC->mStatus);
+        if ((DrvDMA_OK != lRet) && (DrvDMA_OK == mResult))
+        {
+            fprintf(stderr, "ERROR  DrvDMA::Wait failed - %s\n", DrvDMA::GetResultName(lRet));
+            mResult = lRet;
+        }
+
+        lT->mPending--;
+
+        mChunkHead = (mChunkHead + 1) % mChunkQty;
+        mChunkPending--;
+
+        Fill();
+    }
+
+    // After an error, the chunks not yet started are abandoned.
+    assert((DrvDMA_OK != mResult) || (lT->mSize_byte <= lT->mNext_byte));
+
+    mTransferHead = (mTransferHead + 1) % TRANSFER_QTY_MAX;
+    mTransferCount--;
+
+    auto lResult = mResult;
+
+    mResult = DrvDMA_OK;
+
+    return lResult;
+}
+
+DrvDMA_Result LargeTransfer::Transfer(void* aBuffer, uint64_t aHardwareAddress, uint64_t aSize_byte)
+{
+    auto lResult = Start(aBuffer, aHardwareAddress, aSize_byte);
+
+    auto lRet = Wait();
+    if (DrvDMA_OK == lResult)
+    {
+        lResult = lRet;
+    }
+
+    return lResult;
+}
+
+// Private
+// //////////////////////////////////////////////////////////////////////////
+
+// Start chunks until mChunkQty are in flight or all the logical transfers
+// are completely started.
+void LargeTransfer::Fill()
+{
+    unsigned int i = 0;
+
+    while ((DrvDMA_OK == mResult) && (mChunkQty > mChunkPending) && (mTransferCount > i))
+    {
+        auto lIndex = (mTransferHead + i) % TRANSFER_QTY_MAX;
+        auto lT     = mTransfers + lIndex;
+
+        if (lT->mSize_byte <= lT->mNext_byte)
+        {
+            // All the chunks of this logical transfer are started.
+            i++;
+        }
+        else
+        {
+            StartChunk(lIndex);
+        }
+    }
+}
+
+DrvDMA_Result LargeTransfer::StartChunk(unsigned int aTransfer)
+{
+    auto lC = mChunks + ((mChunkHead + mChunkPending) % mChunkQty);
+    auto lT = mTransfers + aTransfer;
+
+    auto lSize_byte = lT->mSize_byte - lT->mNext_byte;
+    if (mChunkSize_byte < lSize_byte)
+    {
+        lSize_byte = mChunkSize_byte;
+    }
+
+    lC->mOwner = aTransfer;
+
+    auto lResult = mDD->Start(mCI, mFromDevice, lT->mBuffer + lT->mNext_byte, 0, lT->mHardwareAddress + lT->mNext_byte, static_cast<unsigned int>(lSize_byte), &lC->mStatus);
+    if (DrvDMA_OK_PENDING == lResult)
+    {
+        lT->mNext_byte += lSize_byte;
+        lT->mPending++;
+
+        mChunkPending++;
+
+        lResult = DrvDMA_OK;
+    }
+    else
+    {
+        fprintf(stderr, "ERROR  DrvDMA::Start failed - %s\n", DrvDMA::GetResultName(lResult));
+        mResult = lResult;
+    }
+
+    return lResult;
+}
@@ -0,0 +1,96 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/LargeTransfer.h
+
+#pragma once
+
+// Transfers larger than the DrvDMA limit. Each logical transfer is split
+// into chunks of at most TRANSFER_SIZE_MAX_byte and up to mChunkQty chunks
+// are kept in flight. A logical transfer is complete when its last chunk
+// is.
+//
+// Several logical transfers can be started before waiting the first one.
+// The chunks of the next logical transfer then start as soon as the ones
+// of the previous transfer complete, so the DMA engine is never idle
+// between two logical transfers.
+//
+// The chunks are only restarted from Wait; an instance is not thread safe.
+class LargeTransfer
+{
+
+public:
+
+    // The number of logical transfers started and not yet waited
+    static const unsigned int TRANSFER_QTY_MAX = 4;
+
+    // aDD              The DrvDMA instance
+    // aCI              The logical index of the configured channel
+    // aFromDevice      true for C2H, false for H2C
+    // aChunkQty        The number of chunks kept in flight
+    // aChunkSize_byte  The chunk size, TRANSFER_SIZE_MAX_byte or less
+    LargeTransfer(DrvDMA* aDD, unsigned int aCI, bool aFromDevice, unsigned int aChunkQty, unsigned int aChunkSize_byte);
+
+    ~LargeTransfer();
+
+    // aBuffer           The host buffer
+    // aHardwareAddress  The address on the internal AXI bus
+    // aSize_byte        The size of the logical transfer
+    //
+    // Return
+    //  DrvDMA_OK
+    //  ...        See DrvDMA::Start
+    DrvDMA_Result Start(void* aBuffer, uint64_t aHardwareAddress, uint64_t aSize_byte);
+
+    // Wait for the completion of the oldest logical transfer
+    //
+    // Return
+    //  DrvDMA_OK
+    //  ...        See DrvDMA::Start and DrvDMA::Wait
+    DrvDMA_Result Wait();
+
+    // Start and Wait
+    DrvDMA_Result Transfer(void* aBuffer, uint64_t aHardwareAddress, uint64_t aSize_byte);
+
+private:
+
+    typedef struct
+    {
+        unsigned int           mOwner; // Index in mTransfers
+        DrvDMA_Transfer_Status mStatus;
+    }
+    Chunk;
+
+    typedef struct
+    {
+        uint8_t    * mBuffer;
+        uint64_t     mHardwareAddress;
+        uint64_t     mNext_byte; // Offset of the next chunk to start
+        unsigned int mPending;   // Chunks in flight
+        uint64_t     mSize_byte;
+    }
+    Logical;
+
+    void Fill();
+
+    DrvDMA_Result StartChunk(unsigned int aTransfer);
+
+    Chunk      * mChunks;
+    unsigned int mChunkHead; // Oldest chunk in flight
+    unsigned int mChunkPending;
+    unsigned int mChunkQty;
+    unsigned int mChunkSize_byte;
+
+    DrvDMA     * mDD;
+    unsigned int mCI;
+    bool         mFromDevice;
+
+    // The first error since the last Wait
+    DrvDMA_Result mResult;
+
+    Logical      mTransfers[TRANSFER_QTY_MAX];
+    unsigned int mTransferHead; // Oldest logical transfer
+    unsigned int mTransferCount;
+
+};
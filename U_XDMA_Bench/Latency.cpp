@@ -0,0 +1,203 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Latency.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "Channel.h"
+#include "Pipeline.h"
+#include "Report.h"
+
+#include "Modes.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+static const char* COLUMNS[] =
+{
+    "direction", "size_byte", "depth", "iteration", "speed_GB_s",
+    "latency_p50_us", "latency_p90_us", "latency_p99_us", "latency_p99_9_us", "latency_max_us",
+    "gap_p50_us", "gap_p90_us", "gap_p99_us", "gap_p99_9_us", "gap_max_us",
+    "stall",
+    nullptr
+};
+
+#define HISTOGRAM_BUCKET_QTY (64)
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static void Histogram_Display(const char* aTitle, const uint64_t* aValues_ns, unsigned int aCount);
+
+static int Latency(DrvDMA* aDD, const Options& aOptions, bool aFromDevice, Report* aReport);
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+int Mode_Latency(DrvDMA* aDD, const Options& aOptions, FILE* aOut)
+{
+    int lResult = 0;
+
+    Report lReport(aOut, aOptions.mFormat, COLUMNS);
+
+    if (0 != (aOptions.mDirections & DIRECTION_H2C))
+    {
+        lResult = Latency(aDD, aOptions, false, &lReport);
+    }
+
+    if ((0 == lResult) && (0 != (aOptions.mDirections & DIRECTION_C2H)))
+    {
+        lResult = Latency(aDD, aOptions, true, &lReport);
+    }
+
+    return lResult;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+// The bucket i counts the values from 2^i ns to 2^(i+1) ns.
+void Histogram_Display(const char* aTitle, const uint64_t* aValues_ns, unsigned int aCount)
+{
+    unsigned int lBuckets[HISTOGRAM_BUCKET_QTY];
+
+    memset(&lBuckets, 0, sizeof(lBuckets));
+
+    for (unsigned int i = 0; i < aCount; i++)
+    {
+        unsigned int lIndex = 0;
+
+        for (auto lValue_ns = aValues_ns[i]; 1 < lValue_ns; lValue_ns >>= 1)
+        {
+            lIndex++;
+        }
+
+        lBuckets[lIndex]++;
+    }
+
+    fprintf(stderr, "    %s\n", aTitle);
+
+    for (unsigned int i = 0; i < HISTOGRAM_BUCKET_QTY; i++)
+    {
+        if (0 < lBuckets[i])
+        {
+            double lLow_us  = static_cast<double>(1ULL << i) / 1000.0;
+            double lHigh_us = lLow_us * 2.0;
+
+            fprintf(stderr, "        %12.3f us to %12.3f us : %u\n", lLow_us, lHigh_us, lBuckets[i]);
+        }
+    }
+}
+
+int Latency(DrvDMA* aDD, const Options& aOptions, bool aFromDevice, Report* aReport)
+{
+    auto lDirection = aFromDevice ? "C2H" : "H2C";
+
+    unsigned int lCI;
+
+    auto lRet = Channel_Open(aDD, aOptions, aFromDevice, 0, &lCI);
+    if (DrvDMA_OK != lRet)
+    {
+        return __LINE__;
+    }
+
+    Pipeline lPipeline(aDD, lCI, aFromDevice, aOptions.mHardwareAddress);
+
+    lPipeline.SetRegisters(Channel_GetRegisters(aDD, aOptions, aFromDevice, 0));
+
+    if (!lPipeline.Pool_Create(aOptions))
+    {
+        return __LINE__;
+    }
+
+    for (auto lSize_byte = aOptions.mSizeMin_byte; lSize_byte <= aOptions.mSizeMax_byte; lSize_byte *= 2)
+    {
+        for (unsigned int d = 0; d < aOptions.mDepthQty; d++)
+        {
+            Pipeline::Config lConfig;
+            Pipeline::Result lResult;
+            Pipeline::Trace  lTrace;
+
+            lConfig.mBufferQty       = aOptions.mDepths[d];
+            lConfig.mBufferSize_byte = lSize_byte;
+            lConfig.mCompletion      = aOptions.mCompletion;
+            lConfig.mIntegrity       = nullptr;
+            lConfig.mIteration       = Options_GetIteration(aOptions, lSize_byte, lConfig.mBufferQty);
+            lConfig.mSpin_us         = aOptions.mSpin_us;
+            lConfig.mStop            = nullptr;
+            lConfig.mTrace           = &lTrace;
+
+            lTrace.mDone_ns  = new uint64_t[lConfig.mIteration];
+            lTrace.mStart_ns = new uint64_t[lConfig.mIteration];
+
+            fprintf(stderr, "%s - %u bytes - depth %u - %u iterations\n", lDirection, lSize_byte, lConfig.mBufferQty, lConfig.mIteration);
+
+            lRet = lPipeline.Run(lConfig, &lResult);
+            if (DrvDMA_OK == lRet)
+            {
+                auto lCount = lResult.mIteration;
+
+                // Completion latency - From the Start call to the return
+                // of the matching Wait
+                auto lLatency_ns = new uint64_t[lCount];
+
+                // Inter-completion gap - Between two consecutive Wait
+                // returns. The first transfer has no gap.
+                auto lGap_ns = new uint64_t[lCount];
+
+                unsigned int lStall = 0;
+
+                for (unsigned int i = 0; i < lCount; i++)
+                {
+                    lLatency_ns[i] = lTrace.mDone_ns[i] - lTrace.mStart_ns[i];
+
+                    if (0 < i)
+                    {
+                        lGap_ns[i - 1] = lTrace.mDone_ns[i] - lTrace.mDone_ns[i - 1];
+
+                        if (static_cast<uint64_t>(aOptions.mStall_us) * 1000 < lGap_ns[i - 1])
+                        {
+                            fprintf(stderr, "    STALL  Iteration %u - %.3f us since the previous completion\n", i, static_cast<double>(lGap_ns[i - 1]) / 1000.0);
+                            lStall++;
+                        }
+                    }
+                }
+
+                Histogram_Display("Completion latency", lLatency_ns, lCount);
+                Histogram_Display("Inter-completion gap", lGap_ns, lCount - 1);
+
+                aReport->Row_Begin();
+                aReport->Value(lDirection);
+                aReport->Value(static_cast<uint64_t>(lSize_byte));
+                aReport->Value(static_cast<uint64_t>(lConfig.mBufferQty));
+                aReport->Value(static_cast<uint64_t>(lCount));
+                aReport->Value(Pipeline::GetSpeed_GB_s(lResult));
+                aReport->Percentiles_us(lLatency_ns, lCount);
+                aReport->Percentiles_us(lGap_ns, lCount - 1);
+                aReport->Value(static_cast<uint64_t>(lStall));
+                aReport->Row_End();
+
+                delete[] lGap_ns;
+                delete[] lLatency_ns;
+            }
+
+            delete[] lTrace.mDone_ns;
+            delete[] lTrace.mStart_ns;
+
+            if (DrvDMA_OK != lRet)
+            {
+                return __LINE__;
+            }
+        }
+
+        if (TRANSFER_SIZE_MAX_byte / 2 < lSize_byte)
+        {
+            break;
+        }
+    }
+
+    return 0;
+}
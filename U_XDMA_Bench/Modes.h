@@ -0,0 +1,30 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Modes.h
+
+#pragma once
+
+// ===== Local ==============================================================
+#include "Options.h"
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+// aDD       The DrvDMA instance
+// aOptions  The options
+// aOut      The output stream for the result table
+//
+// Return  0 on success, the source line of the error otherwise
+extern int Mode_Alloc     (DrvDMA* aDD, const Options& aOptions, FILE* aOut);
+extern int Mode_Channels  (DrvDMA* aDD, const Options& aOptions, FILE* aOut);
+extern int Mode_Checker   (DrvDMA* aDD, const Options& aOptions, FILE* aOut);
+extern int Mode_Completion(DrvDMA* aDD, const Options& aOptions, FILE* aOut);
+extern int Mode_Duplex    (DrvDMA* aDD, const Options& aOptions, FILE* aOut);
+extern int Mode_Gather    (DrvDMA* aDD, const Options& aOptions, FILE* aOut);
+extern int Mode_Integrity (DrvDMA* aDD, const Options& aOptions, FILE* aOut);
+extern int Mode_Large     (DrvDMA* aDD, const Options& aOptions, FILE* aOut);
+extern int Mode_Latency   (DrvDMA* aDD, const Options& aOptions, FILE* aOut);
+extern int Mode_Placement (DrvDMA* aDD, const Options& aOptions, FILE* aOut);
+extern int Mode_Sweep     (DrvDMA* aDD, const Options& aOptions, FILE* aOut);
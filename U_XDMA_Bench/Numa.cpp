@@ -0,0 +1,274 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Numa.cpp
+
+#include "Component.h"
+
+#ifdef _KMS_LINUX_
+    // ===== System =========================================================
+    #include <dirent.h>
+    #include <sched.h>
+#endif
+
+// ===== Local ==============================================================
+#include "Numa.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+#ifdef _KMS_LINUX_
+    #define PCI_DEVICES "/sys/bus/pci/devices"
+    #define SYS_NODE    "/sys/devices/system/node"
+#endif
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+#ifdef _KMS_LINUX_
+    static bool ReadLine(const char* aFileName, char* aOut, unsigned int aOutSize_byte);
+#endif
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+int Numa_GetDeviceNode(DrvDMA* aDD)
+{
+    assert(nullptr != aDD);
+
+    #ifdef _KMS_LINUX_
+        uint32_t lId;
+
+        auto lRet = aDD->PCIeConfig_Read(0, &lId);
+        if (DrvDMA_OK != lRet)
+        {
+            fprintf(stderr, "WARNING  DrvDMA::PCIeConfig_Read failed - %s\n", DrvDMA::GetResultName(lRet));
+            return NUMA_NODE_ANY;
+        }
+
+        auto lDevice = lId >> 16;
+        auto lVendor = lId & 0xffff;
+
+        auto lDir = opendir(PCI_DEVICES);
+        if (nullptr == lDir)
+        {
+            return NUMA_NODE_ANY;
+        }
+
+        unsigned int lMatch  = 0;
+        int          lResult = NUMA_NODE_ANY;
+
+        struct dirent* lEntry;
+
+        while (nullptr != (lEntry = readdir(lDir)))
+        {
+            if ('.' == lEntry->d_name[0])
+            {
+                continue;
+            }
+
+            char lFileName[320];
+            char lLine[64];
+
+            sprintf(lFileName, PCI_DEVICES "/%s/vendor", lEntry->d_name);
+            if ((!ReadLine(lFileName, lLine, sizeof(lLine))) || (lVendor != strtoul(lLine, nullptr, 16)))
+            {
+                continue;
+            }
+
+            sprintf(lFileName, PCI_DEVICES "/%s/device", lEntry->d_name);
+            if ((!ReadLine(lFileName, lLine, sizeof(lLine))) || (lDevice != strtoul(lLine, nullptr, 16)))
+            {
+                continue;
+            }
+
+            sprintf(lFileName, PCI_DEVICES "/%s/numa_node", lEntry->d_name);
+            if (ReadLine(lFileName, lLine, sizeof(lLine)))
+            {
+                lResult = atoi(lLine);
+            }
+
+            fprintf(stderr, "Device %04x:%04x - %s - NUMA node %d\n", lVendor, lDevice, lEntry->d_name, lResult);
+
+            lMatch++;
+        }
+
+        closedir(lDir);
+
+        if (1 < lMatch)
+        {
+            fprintf(stderr, "WARNING  %u devices %04x:%04x, use --numa-node\n", lMatch, lVendor, lDevice);
+            lResult = NUMA_NODE_ANY;
+        }
+
+        // The kernel reports -1 when the platform gives no affinity.
+        return (0 > lResult) ? NUMA_NODE_ANY : lResult;
+    #endif
+
+    #ifdef _KMS_WINDOWS_
+        return NUMA_NODE_ANY;
+    #endif
+}
+
+unsigned int Numa_GetNodeQty()
+{
+    #ifdef _KMS_LINUX_
+        // The file contains "0" or a range as "0-1".
+        char lLine[64];
+
+        if (!ReadLine(SYS_NODE "/possible", lLine, sizeof(lLine)))
+        {
+            return 1;
+        }
+
+        auto lLast = strrchr(lLine, '-');
+
+        return (nullptr == lLast) ? 1 : (strtoul(lLast + 1, nullptr, 10) + 1);
+    #endif
+
+    #ifdef _KMS_WINDOWS_
+        ULONG lHighest;
+
+        return GetNumaHighestNodeNumber(&lHighest) ? (lHighest + 1) : 1;
+    #endif
+}
+
+bool Numa_PinThread(int aNode)
+{
+    assert(0 <= aNode);
+
+    #ifdef _KMS_LINUX_
+        // The file contains a list of ranges as "0-7,16-23".
+        char lFileName[64];
+        char lLine[1024];
+
+        sprintf(lFileName, SYS_NODE "/node%d/cpulist", aNode);
+
+        if (!ReadLine(lFileName, lLine, sizeof(lLine)))
+        {
+            return false;
+        }
+
+        cpu_set_t lSet;
+
+        CPU_ZERO(&lSet);
+
+        auto lPtr = lLine;
+
+        while (('0' <= *lPtr) && ('9' >= *lPtr))
+        {
+            char* lEnd;
+
+            auto lFirst = strtoul(lPtr, &lEnd, 10);
+            auto lLast  = lFirst;
+
+            if ('-' == *lEnd)
+            {
+                lLast = strtoul(lEnd + 1, &lEnd, 10);
+            }
+
+            for (auto lCPU = lFirst; (lCPU <= lLast) && (CPU_SETSIZE > lCPU); lCPU++)
+            {
+                CPU_SET(lCPU, &lSet);
+            }
+
+            lPtr = (',' == *lEnd) ? (lEnd + 1) : lEnd;
+        }
+
+        return (0 < CPU_COUNT(&lSet)) && (0 == sched_setaffinity(0, sizeof(lSet), &lSet));
+    #endif
+
+    #ifdef _KMS_WINDOWS_
+        GROUP_AFFINITY lGA;
+
+        memset(&lGA, 0, sizeof(lGA));
+
+        return GetNumaNodeProcessorMaskEx(static_cast<USHORT>(aNode), &lGA) && SetThreadGroupAffinity(GetCurrentThread(), &lGA, nullptr);
+    #endif
+}
+
+bool Numa_GetNodes(DrvDMA* aDD, const Options& aOptions, int* aLocal, int* aRemote)
+{
+    assert(nullptr != aLocal);
+    assert(nullptr != aRemote);
+
+    auto lLocal = aOptions.mDeviceNode;
+    if (NUMA_NODE_ANY == lLocal)
+    {
+        lLocal = Numa_GetDeviceNode(aDD);
+        if (NUMA_NODE_ANY == lLocal)
+        {
+            fprintf(stderr, "ERROR  The NUMA node of the device is not known, use --numa-node\n");
+            return false;
+        }
+    }
+
+    auto lNodeQty = Numa_GetNodeQty();
+
+    *aLocal  = lLocal;
+    *aRemote = (2 > lNodeQty) ? NUMA_NODE_ANY : ((lLocal + 1) % lNodeQty);
+
+    return true;
+}
+
+bool Numa_Place(DrvDMA* aDD, Options* aOptions)
+{
+    assert(nullptr != aOptions);
+
+    int lLocal;
+    int lRemote;
+
+    aOptions->mNode = NUMA_NODE_ANY;
+
+    if (PLACEMENT_ANY == aOptions->mPlacement)
+    {
+        return true;
+    }
+
+    if (!Numa_GetNodes(aDD, *aOptions, &lLocal, &lRemote))
+    {
+        return false;
+    }
+
+    auto lNode = (PLACEMENT_LOCAL == aOptions->mPlacement) ? lLocal : lRemote;
+    if (NUMA_NODE_ANY == lNode)
+    {
+        fprintf(stderr, "ERROR  The system has only one NUMA node\n");
+        return false;
+    }
+
+    if (!Numa_PinThread(lNode))
+    {
+        fprintf(stderr, "ERROR  Cannot pin the thread to the NUMA node %d\n", lNode);
+        return false;
+    }
+
+    fprintf(stderr, "Buffers and threads on the NUMA node %d, the device is on the node %d\n", lNode, lLocal);
+
+    aOptions->mNode = lNode;
+
+    return true;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+#ifdef _KMS_LINUX_
+
+    bool ReadLine(const char* aFileName, char* aOut, unsigned int aOutSize_byte)
+    {
+        auto lFile = fopen(aFileName, "r");
+        if (nullptr == lFile)
+        {
+            return false;
+        }
+
+        auto lResult = (nullptr != fgets(aOut, aOutSize_byte, lFile));
+
+        fclose(lFile);
+
+        return lResult;
+    }
+
+#endif
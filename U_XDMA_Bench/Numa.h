@@ -0,0 +1,54 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Numa.h
+
+#pragma once
+
+// ===== Local ==============================================================
+#include "Options.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+#define NUMA_NODE_ANY (-1)
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+// On Linux, find the device in /sys/bus/pci/devices using the vendor and
+// device ID of its PCIe configuration space. Not available on Windows, use
+// the --numa-node option.
+//
+// aDD  The connected DrvDMA instance
+//
+// Return  The NUMA node of the device or NUMA_NODE_ANY if it is unknown
+extern int Numa_GetDeviceNode(DrvDMA* aDD);
+
+// Return  The number of NUMA nodes, 1 when the system is not NUMA
+extern unsigned int Numa_GetNodeQty();
+
+// Pin the calling thread to the processors of a node. On Linux, the
+// threads it creates after inherit the affinity.
+//
+// Return  false if the affinity cannot be set
+extern bool Numa_PinThread(int aNode);
+
+// Find the device node, unless --numa-node gives it, select the node to
+// use following mPlacement, pin the calling thread there and set mNode,
+// so the buffer pools are allocated there.
+//
+// aDD       The DrvDMA instance
+// aOptions  The options
+//
+// Return  false if the placement is not possible
+extern bool Numa_Place(DrvDMA* aDD, Options* aOptions);
+
+// aDD        The DrvDMA instance
+// aOptions   The options
+// aLocal  [---;-W-] The device node
+// aRemote [---;-W-] Another node, NUMA_NODE_ANY if the system has only one
+//
+// Return  false if the device node is not known
+extern bool Numa_GetNodes(DrvDMA* aDD, const Options& aOptions, int* aLocal, int* aRemote);
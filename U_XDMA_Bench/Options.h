@@ -0,0 +1,121 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Options.h
+
+#pragma once
+
+// ===== Local ==============================================================
+#include "Pattern.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+#define DEPTH_QTY_MAX (16)
+
+// Data types
+// //////////////////////////////////////////////////////////////////////////
+
+typedef enum
+{
+    ALLOC_HUGE,   // BufferPool, 2 MiB pages when available
+    ALLOC_LEGACY, // new uint8_t[] for each run, as U_XDMA_H2C_Perf
+    ALLOC_PAGE,   // BufferPool, normal pages
+}
+Alloc;
+
+typedef enum
+{
+    COMPLETION_HYBRID, // Spin up to mSpin_us, then DrvDMA::Wait
+    COMPLETION_POLL,   // Spin until the transfer is complete
+    COMPLETION_WAIT,   // DrvDMA::Wait only, as the other samples
+
+    COMPLETION_QTY
+}
+Completion;
+
+typedef enum
+{
+    FORMAT_CSV,
+    FORMAT_JSON,
+}
+Format;
+
+typedef enum
+{
+    PLACEMENT_ANY,    // Let the system place the buffers and the threads
+    PLACEMENT_LOCAL,  // On the NUMA node of the device
+    PLACEMENT_REMOTE, // On another NUMA node
+}
+Placement;
+
+typedef struct
+{
+    const char* mMode;
+    const char* mOutput;
+
+    Alloc mAlloc;
+
+    // Logical index of the BAR giving access to the XDMA registers
+    unsigned int mBAR;
+    unsigned int mChannelQty;
+
+    // How the sweep and latency modes wait for the completions
+    Completion   mCompletion;
+    unsigned int mDevice;
+
+    // NUMA node of the device given by --numa-node, NUMA_NODE_ANY to find
+    // it, and NUMA node of the buffers set by Numa_Place
+    int       mDeviceNode;
+    int       mNode;
+    Placement mPlacement;
+
+    // DIRECTION_H2C and/or DIRECTION_C2H
+    unsigned int mDirections;
+
+    Format mFormat;
+
+    // Use the DrvDMA_SIM engine. The driver does not need to be installed.
+    bool mSimulate;
+
+    unsigned int mDepths[DEPTH_QTY_MAX];
+    unsigned int mDepthQty;
+
+    // The iteration count of each measure is mBytes / transfer size, but
+    // never less than mIterationMin.
+    uint64_t     mBytes;
+    unsigned int mIterationMin;
+
+    // The size of the logical transfers of the large mode
+    unsigned int mLargeSize_byte;
+
+    // The data pattern of the checker and integrity modes
+    Pattern  mPattern;
+    uint32_t mSeed;
+
+    unsigned int mSizeMax_byte;
+    unsigned int mSizeMin_byte;
+
+    // The longest spin of COMPLETION_HYBRID
+    unsigned int mSpin_us;
+
+    // Inter-completion gap over which a transfer is reported as a stall
+    unsigned int mStall_us;
+
+    uint64_t mHardwareAddress;
+}
+Options;
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+// Return  The largest value of mDepths
+extern unsigned int Options_GetDepthMax(const Options& aOptions);
+
+// aOptions  The Options instance to compute the iteration count for
+// aSize_byte  The transfer size
+// aDepth      The pipeline depth
+//
+// Return  The iteration count to use
+extern unsigned int Options_GetIteration(const Options& aOptions, unsigned int aSize_byte, unsigned int aDepth);
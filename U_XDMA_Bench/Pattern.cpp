@@ -0,0 +1,406 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Pattern.cpp
+
+#include "Component.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define PATTERN_X86
+
+    // ===== C ==============================================================
+    #include <immintrin.h>
+
+    #ifdef _KMS_WINDOWS_
+        #include <intrin.h>
+    #endif
+#endif
+
+// ===== Local ==============================================================
+#include "Pattern.h"
+
+// Macros
+// //////////////////////////////////////////////////////////////////////////
+
+// GCC only emits the SSE4.1 and AVX2 instructions in the functions
+// declared with the matching target. The code is only called after the
+// run time check of Pattern_Impl_IsSupported.
+#ifdef _KMS_LINUX_
+    #define TARGET_AVX2  __attribute__((target("avx2")))
+    #define TARGET_SSE41 __attribute__((target("sse4.1")))
+#endif
+
+#ifdef _KMS_WINDOWS_
+    #define TARGET_AVX2
+    #define TARGET_SSE41
+#endif
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+#define HASH_0 (0x9e3779b1)
+#define HASH_1 (0x85ebca77)
+
+// Words checked between two tests of the accumulated difference
+#define BLOCK_WORD (32)
+
+static const char* IMPL_NAMES[PATTERN_IMPL_QTY] = { "scalar", "sse41", "avx2" };
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static uint32_t Expected(Pattern aPattern, uint32_t aSeed, uint32_t aIndex);
+
+static unsigned int Check_Scalar(Pattern aPattern, uint32_t aSeed, uint32_t aIndex, const uint32_t* aIn, unsigned int aWord, uint64_t aOffset_byte, Pattern_Error* aErrors, unsigned int aErrorMax, unsigned int aErrorCount);
+static void         Fill_Scalar (Pattern aPattern, uint32_t aSeed, uint32_t aIndex, uint32_t* aOut, unsigned int aWord);
+
+static unsigned int Tail_Check(Pattern aPattern, uint32_t aSeed, uint32_t aIndex, const uint8_t* aIn, unsigned int aSize_byte, uint64_t aOffset_byte, Pattern_Error* aErrors, unsigned int aErrorMax, unsigned int aErrorCount);
+static void         Tail_Fill (Pattern aPattern, uint32_t aSeed, uint32_t aIndex, uint8_t* aOut, unsigned int aSize_byte);
+
+#ifdef PATTERN_X86
+
+    static unsigned int Check_AVX2 (Pattern aPattern, uint32_t aSeed, uint32_t aIndex, const uint32_t* aIn, unsigned int aWord, Pattern_Error* aErrors, unsigned int aErrorMax);
+    static unsigned int Check_SSE41(Pattern aPattern, uint32_t aSeed, uint32_t aIndex, const uint32_t* aIn, unsigned int aWord, Pattern_Error* aErrors, unsigned int aErrorMax);
+    static void         Fill_AVX2  (Pattern aPattern, uint32_t aSeed, uint32_t aIndex, uint32_t* aOut, unsigned int aWord);
+    static void         Fill_SSE41 (Pattern aPattern, uint32_t aSeed, uint32_t aIndex, uint32_t* aOut, unsigned int aWord);
+
+#endif
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+Pattern_Impl Pattern_Impl_Best()
+{
+    if (Pattern_Impl_IsSupported(PATTERN_IMPL_AVX2))
+    {
+        return PATTERN_IMPL_AVX2;
+    }
+
+    if (Pattern_Impl_IsSupported(PATTERN_IMPL_SSE41))
+    {
+        return PATTERN_IMPL_SSE41;
+    }
+
+    return PATTERN_IMPL_SCALAR;
+}
+
+const char* Pattern_Impl_GetName(Pattern_Impl aImpl)
+{
+    assert(PATTERN_IMPL_QTY > aImpl);
+
+    return IMPL_NAMES[aImpl];
+}
+
+bool Pattern_Impl_IsSupported(Pattern_Impl aImpl)
+{
+    switch (aImpl)
+    {
+    case PATTERN_IMPL_SCALAR: return true;
+
+    #ifdef PATTERN_X86
+
+        #ifdef _KMS_LINUX_
+            case PATTERN_IMPL_AVX2 : return __builtin_cpu_supports("avx2");
+            case PATTERN_IMPL_SSE41: return __builtin_cpu_supports("sse4.1");
+        #endif
+
+        #ifdef _KMS_WINDOWS_
+            case PATTERN_IMPL_AVX2:
+            {
+                int lInfo[4];
+
+                // OSXSAVE, then the YMM state enabled by the OS, then AVX2
+                __cpuid(lInfo, 1);
+                if ((0 == (lInfo[2] & (1 << 27))) || (0x6 != (_xgetbv(0) & 0x6)))
+                {
+                    return false;
+                }
+
+                __cpuidex(lInfo, 7, 0);
+                return 0 != (lInfo[1] & (1 << 5));
+            }
+
+            case PATTERN_IMPL_SSE41:
+            {
+                int lInfo[4];
+
+                __cpuid(lInfo, 1);
+                return 0 != (lInfo[2] & (1 << 19));
+            }
+        #endif
+
+    #endif
+
+    default: break;
+    }
+
+    return false;
+}
+
+void Pattern_Fill(Pattern_Impl aImpl, Pattern aPattern, uint32_t aSeed, uint64_t aOffset_byte, void* aOut, unsigned int aSize_byte)
+{
+    assert(0 == (aOffset_byte % sizeof(uint32_t)));
+    assert(nullptr != aOut);
+
+    auto lIndex = static_cast<uint32_t>(aOffset_byte / sizeof(uint32_t));
+    auto lOut   = reinterpret_cast<uint32_t*>(aOut);
+    auto lWord  = aSize_byte / sizeof(uint32_t);
+
+    switch (aImpl)
+    {
+    #ifdef PATTERN_X86
+        case PATTERN_IMPL_AVX2 : Fill_AVX2 (aPattern, aSeed, lIndex, lOut, lWord); break;
+        case PATTERN_IMPL_SSE41: Fill_SSE41(aPattern, aSeed, lIndex, lOut, lWord); break;
+    #endif
+
+    default: Fill_Scalar(aPattern, aSeed, lIndex, lOut, lWord);
+    }
+
+    Tail_Fill(aPattern, aSeed, lIndex + lWord, reinterpret_cast<uint8_t*>(lOut + lWord), aSize_byte % sizeof(uint32_t));
+}
+
+unsigned int Pattern_Check(Pattern_Impl aImpl, Pattern aPattern, uint32_t aSeed, uint64_t aOffset_byte, const void* aIn, unsigned int aSize_byte, Pattern_Error* aErrors, unsigned int aErrorMax)
+{
+    assert(0 == (aOffset_byte % sizeof(uint32_t)));
+    assert(nullptr != aIn);
+    assert((nullptr != aErrors) || (0 == aErrorMax));
+
+    auto lIn    = reinterpret_cast<const uint32_t*>(aIn);
+    auto lIndex = static_cast<uint32_t>(aOffset_byte / sizeof(uint32_t));
+    auto lWord  = aSize_byte / sizeof(uint32_t);
+
+    unsigned int lResult;
+
+    switch (aImpl)
+    {
+    #ifdef PATTERN_X86
+        case PATTERN_IMPL_AVX2 : lResult = Check_AVX2 (aPattern, aSeed, lIndex, lIn, lWord, aErrors, aErrorMax); break;
+        case PATTERN_IMPL_SSE41: lResult = Check_SSE41(aPattern, aSeed, lIndex, lIn, lWord, aErrors, aErrorMax); break;
+    #endif
+
+    default: lResult = Check_Scalar(aPattern, aSeed, lIndex, lIn, lWord, 0, aErrors, aErrorMax, 0);
+    }
+
+    return Tail_Check(aPattern, aSeed, lIndex + lWord, reinterpret_cast<const uint8_t*>(lIn + lWord), aSize_byte % sizeof(uint32_t), lWord * sizeof(uint32_t), aErrors, aErrorMax, lResult);
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+uint32_t Expected(Pattern aPattern, uint32_t aSeed, uint32_t aIndex)
+{
+    uint32_t lResult = aSeed + aIndex;
+
+    if (PATTERN_RANDOM == aPattern)
+    {
+        lResult *= HASH_0;
+        lResult ^= lResult >> 15;
+        lResult *= HASH_1;
+        lResult ^= lResult >> 13;
+    }
+
+    return lResult;
+}
+
+// aOffset_byte  The offset of aIn in the buffer, for the error report
+// aErrorCount   The number of mismatches already found in the buffer
+//
+// Return  aErrorCount plus the number of mismatches in aIn
+unsigned int Check_Scalar(Pattern aPattern, uint32_t aSeed, uint32_t aIndex, const uint32_t* aIn, unsigned int aWord, uint64_t aOffset_byte, Pattern_Error* aErrors, unsigned int aErrorMax, unsigned int aErrorCount)
+{
+    auto lResult = aErrorCount;
+
+    for (unsigned int i = 0; i < aWord; i++)
+    {
+        auto lExpected = Expected(aPattern, aSeed, aIndex + i);
+
+        if (lExpected != aIn[i])
+        {
+            if (aErrorMax > lResult)
+            {
+                aErrors[lResult].mActual      = aIn[i];
+                aErrors[lResult].mExpected    = lExpected;
+                aErrors[lResult].mOffset_byte = aOffset_byte + i * sizeof(uint32_t);
+            }
+
+            lResult++;
+        }
+    }
+
+    return lResult;
+}
+
+void Fill_Scalar(Pattern aPattern, uint32_t aSeed, uint32_t aIndex, uint32_t* aOut, unsigned int aWord)
+{
+    for (unsigned int i = 0; i < aWord; i++)
+    {
+        aOut[i] = Expected(aPattern, aSeed, aIndex + i);
+    }
+}
+
+// The last 1 to 3 bytes of a buffer hold the first bytes of the next word.
+unsigned int Tail_Check(Pattern aPattern, uint32_t aSeed, uint32_t aIndex, const uint8_t* aIn, unsigned int aSize_byte, uint64_t aOffset_byte, Pattern_Error* aErrors, unsigned int aErrorMax, unsigned int aErrorCount)
+{
+    auto lResult = aErrorCount;
+
+    if (0 < aSize_byte)
+    {
+        uint32_t lActual   = 0;
+        uint32_t lExpected = 0;
+        uint32_t lWord     = Expected(aPattern, aSeed, aIndex);
+
+        memcpy(&lActual  , aIn   , aSize_byte);
+        memcpy(&lExpected, &lWord, aSize_byte);
+
+        if (lExpected != lActual)
+        {
+            if (aErrorMax > lResult)
+            {
+                aErrors[lResult].mActual      = lActual;
+                aErrors[lResult].mExpected    = lExpected;
+                aErrors[lResult].mOffset_byte = aOffset_byte;
+            }
+
+            lResult++;
+        }
+    }
+
+    return lResult;
+}
+
+void Tail_Fill(Pattern aPattern, uint32_t aSeed, uint32_t aIndex, uint8_t* aOut, unsigned int aSize_byte)
+{
+    if (0 < aSize_byte)
+    {
+        uint32_t lWord = Expected(aPattern, aSeed, aIndex);
+
+        memcpy(aOut, &lWord, aSize_byte);
+    }
+}
+
+#ifdef PATTERN_X86
+
+    // The vector versions compute 8 (AVX2) or 4 (SSE4.1) words at a time,
+    // the same way Expected does. The words left after the last complete
+    // vector, and the blocks containing a mismatch, go to the scalar code.
+
+    TARGET_AVX2 static inline __m256i Expected_AVX2(Pattern aPattern, __m256i aN)
+    {
+        if (PATTERN_RANDOM == aPattern)
+        {
+            aN = _mm256_mullo_epi32(aN, _mm256_set1_epi32(HASH_0));
+            aN = _mm256_xor_si256  (aN, _mm256_srli_epi32(aN, 15));
+            aN = _mm256_mullo_epi32(aN, _mm256_set1_epi32(HASH_1));
+            aN = _mm256_xor_si256  (aN, _mm256_srli_epi32(aN, 13));
+        }
+
+        return aN;
+    }
+
+    TARGET_SSE41 static inline __m128i Expected_SSE41(Pattern aPattern, __m128i aN)
+    {
+        if (PATTERN_RANDOM == aPattern)
+        {
+            aN = _mm_mullo_epi32(aN, _mm_set1_epi32(HASH_0));
+            aN = _mm_xor_si128  (aN, _mm_srli_epi32(aN, 15));
+            aN = _mm_mullo_epi32(aN, _mm_set1_epi32(HASH_1));
+            aN = _mm_xor_si128  (aN, _mm_srli_epi32(aN, 13));
+        }
+
+        return aN;
+    }
+
+    TARGET_AVX2 unsigned int Check_AVX2(Pattern aPattern, uint32_t aSeed, uint32_t aIndex, const uint32_t* aIn, unsigned int aWord, Pattern_Error* aErrors, unsigned int aErrorMax)
+    {
+        auto lStep = _mm256_set1_epi32(8);
+
+        unsigned int lResult = 0;
+        unsigned int i;
+
+        for (i = 0; i + BLOCK_WORD <= aWord; i += BLOCK_WORD)
+        {
+            auto lDiff = _mm256_setzero_si256();
+            auto lN    = _mm256_add_epi32(_mm256_set1_epi32(aSeed + aIndex + i), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+
+            for (unsigned int j = 0; j < BLOCK_WORD; j += 8)
+            {
+                auto lActual = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(aIn + i + j));
+
+                lDiff = _mm256_or_si256(lDiff, _mm256_xor_si256(lActual, Expected_AVX2(aPattern, lN)));
+                lN    = _mm256_add_epi32(lN, lStep);
+            }
+
+            if (!_mm256_testz_si256(lDiff, lDiff))
+            {
+                lResult = Check_Scalar(aPattern, aSeed, aIndex + i, aIn + i, BLOCK_WORD, i * sizeof(uint32_t), aErrors, aErrorMax, lResult);
+            }
+        }
+
+        return Check_Scalar(aPattern, aSeed, aIndex + i, aIn + i, aWord - i, i * sizeof(uint32_t), aErrors, aErrorMax, lResult);
+    }
+
+    TARGET_SSE41 unsigned int Check_SSE41(Pattern aPattern, uint32_t aSeed, uint32_t aIndex, const uint32_t* aIn, unsigned int aWord, Pattern_Error* aErrors, unsigned int aErrorMax)
+    {
+        auto lStep = _mm_set1_epi32(4);
+
+        unsigned int lResult = 0;
+        unsigned int i;
+
+        for (i = 0; i + BLOCK_WORD <= aWord; i += BLOCK_WORD)
+        {
+            auto lDiff = _mm_setzero_si128();
+            auto lN    = _mm_add_epi32(_mm_set1_epi32(aSeed + aIndex + i), _mm_setr_epi32(0, 1, 2, 3));
+
+            for (unsigned int j = 0; j < BLOCK_WORD; j += 4)
+            {
+                auto lActual = _mm_loadu_si128(reinterpret_cast<const __m128i*>(aIn + i + j));
+
+                lDiff = _mm_or_si128 (lDiff, _mm_xor_si128(lActual, Expected_SSE41(aPattern, lN)));
+                lN    = _mm_add_epi32(lN, lStep);
+            }
+
+            if (!_mm_testz_si128(lDiff, lDiff))
+            {
+                lResult = Check_Scalar(aPattern, aSeed, aIndex + i, aIn + i, BLOCK_WORD, i * sizeof(uint32_t), aErrors, aErrorMax, lResult);
+            }
+        }
+
+        return Check_Scalar(aPattern, aSeed, aIndex + i, aIn + i, aWord - i, i * sizeof(uint32_t), aErrors, aErrorMax, lResult);
+    }
+
+    TARGET_AVX2 void Fill_AVX2(Pattern aPattern, uint32_t aSeed, uint32_t aIndex, uint32_t* aOut, unsigned int aWord)
+    {
+        auto lN    = _mm256_add_epi32(_mm256_set1_epi32(aSeed + aIndex), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        auto lStep = _mm256_set1_epi32(8);
+
+        unsigned int i;
+
+        for (i = 0; i + 8 <= aWord; i += 8)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(aOut + i), Expected_AVX2(aPattern, lN));
+
+            lN = _mm256_add_epi32(lN, lStep);
+        }
+
+        Fill_Scalar(aPattern, aSeed, aIndex + i, aOut + i, aWord - i);
+    }
+
+    TARGET_SSE41 void Fill_SSE41(Pattern aPattern, uint32_t aSeed, uint32_t aIndex, uint32_t* aOut, unsigned int aWord)
+    {
+        auto lN    = _mm_add_epi32(_mm_set1_epi32(aSeed + aIndex), _mm_setr_epi32(0, 1, 2, 3));
+        auto lStep = _mm_set1_epi32(4);
+
+        unsigned int i;
+
+        for (i = 0; i + 4 <= aWord; i += 4)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(aOut + i), Expected_SSE41(aPattern, lN));
+
+            lN = _mm_add_epi32(lN, lStep);
+        }
+
+        Fill_Scalar(aPattern, aSeed, aIndex + i, aOut + i, aWord - i);
+    }
+
+#endif
@@ -0,0 +1,73 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Pattern.h
+
+#pragma once
+
+// Seeded data patterns, made of 32 bit little endian words. The value of
+// a word only depends on the seed and on the word offset, so any part of
+// a buffer can be generated or checked independently and in parallel.
+
+// Data types
+// //////////////////////////////////////////////////////////////////////////
+
+typedef enum
+{
+    PATTERN_COUNTER, // Seed + word index
+    PATTERN_RANDOM,  // Hash of (seed + word index)
+}
+Pattern;
+
+typedef enum
+{
+    PATTERN_IMPL_SCALAR,
+    PATTERN_IMPL_SSE41,
+    PATTERN_IMPL_AVX2,
+
+    PATTERN_IMPL_QTY
+}
+Pattern_Impl;
+
+typedef struct
+{
+    uint64_t mOffset_byte;
+    uint32_t mActual;
+    uint32_t mExpected;
+}
+Pattern_Error;
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+// Return  The fastest implementation the processor supports
+extern Pattern_Impl Pattern_Impl_Best();
+
+// Return  The implementation name, "scalar", "sse41" or "avx2"
+extern const char* Pattern_Impl_GetName(Pattern_Impl aImpl);
+
+// aImpl  The implementation
+//
+// Return  false if the processor does not support this implementation
+extern bool Pattern_Impl_IsSupported(Pattern_Impl aImpl);
+
+// aImpl         The implementation
+// aPattern      The pattern
+// aSeed         The seed
+// aOffset_byte  The offset of the buffer in the pattern, a multiple of 4
+// aOut          The buffer
+// aSize_byte    The buffer size
+extern void Pattern_Fill(Pattern_Impl aImpl, Pattern aPattern, uint32_t aSeed, uint64_t aOffset_byte, void* aOut, unsigned int aSize_byte);
+
+// aImpl         The implementation
+// aPattern      The pattern
+// aSeed         The seed
+// aOffset_byte  The offset of the buffer in the pattern, a multiple of 4
+// aIn           The buffer
+// aSize_byte    The buffer size
+// aErrors [---;-W-] The first mismatches, offsets relative to aIn
+// aErrorMax     The size of aErrors
+//
+// Return  The number of mismatching words
+extern unsigned int Pattern_Check(Pattern_Impl aImpl, Pattern aPattern, uint32_t aSeed, uint64_t aOffset_byte, const void* aIn, unsigned int aSize_byte, Pattern_Error* aErrors, unsigned int aErrorMax);
@@ -0,0 +1,482 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Pipeline.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "BufferPool.h"
+#include "Clock.h"
+
+#include "Pipeline.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+// H2C / C2H Channel Completed Descriptor Count, see the XDMA product guide
+// (PG195). The engine increments it after each descriptor.
+#define COMPLETED_DESC_COUNT (0x48 / sizeof(uint32_t))
+
+// COMPLETION_POLL gives up spinning and calls DrvDMA::Wait after 1 s.
+#define POLL_TIMEOUT_ns (1000000000)
+
+// Public
+// //////////////////////////////////////////////////////////////////////////
+
+Pipeline::Pipeline(DrvDMA* aDD, unsigned int aCI, bool aFromDevice, uint64_t aHardwareAddress)
+    : mDD(aDD), mCI(aCI), mCompletion(COMPLETION_WAIT), mDescEnd(0), mFromDevice(aFromDevice), mHardwareAddress(aHardwareAddress), mIntegrity(nullptr), mPool(nullptr), mSpin_ns(0), mStartTotal_ns(0), mTrace(nullptr), mRegisters(nullptr)
+{
+    assert(nullptr != aDD);
+}
+
+Pipeline::~Pipeline()
+{
+    SetPool(nullptr);
+}
+
+bool Pipeline::Pool_Create(const Options& aOptions)
+{
+    BufferPool* lPool = nullptr;
+
+    if (ALLOC_LEGACY != aOptions.mAlloc)
+    {
+        lPool = BufferPool::Create(aOptions.mAlloc, aOptions.mNode, Options_GetDepthMax(aOptions), aOptions.mSizeMax_byte);
+        if (nullptr == lPool)
+        {
+            return false;
+        }
+    }
+
+    SetPool(lPool);
+
+    return true;
+}
+
+void Pipeline::SetRegisters(volatile uint32_t* aChannel)
+{
+    mRegisters = aChannel;
+}
+
+void Pipeline::SetPool(BufferPool* aPool)
+{
+    if (nullptr != mPool)
+    {
+        delete mPool;
+    }
+
+    mPool = aPool;
+}
+
+DrvDMA_Result Pipeline::Run(const Config& aConfig, Result* aResult)
+{
+    assert(0 < aConfig.mBufferQty);
+    assert(0 < aConfig.mBufferSize_byte);
+    assert(TRANSFER_SIZE_MAX_byte >= aConfig.mBufferSize_byte);
+    assert(aConfig.mBufferQty <= aConfig.mIteration);
+    assert(nullptr != aResult);
+
+    auto lBuffers = new Buffer[aConfig.mBufferQty];
+    auto lResult  = DrvDMA_OK;
+
+    unsigned int i;
+
+    for (i = 0; i < aConfig.mBufferQty; i++)
+    {
+        Buffer_Alloc(lBuffers + i, aConfig.mBufferSize_byte);
+    }
+
+    mCompletion = aConfig.mCompletion;
+    mSpin_ns    = static_cast<uint64_t>(aConfig.mSpin_us) * 1000;
+
+    if ((COMPLETION_WAIT != mCompletion) && (!Calibrate(lBuffers, aConfig.mBufferQty, aConfig.mBufferSize_byte)))
+    {
+        mCompletion = COMPLETION_WAIT;
+    }
+
+    mIntegrity     = aConfig.mIntegrity;
+    mStartTotal_ns = 0;
+    mTrace         = aConfig.mTrace;
+
+    if (nullptr != mIntegrity)
+    {
+        mIntegrity->mErrorCount = 0;
+        mIntegrity->mErrorQty   = 0;
+        mIntegrity->mPattern_ns = 0;
+    }
+
+    auto lStartCpu_ns = Clock_GetThreadCpu_ns();
+    auto lStart_ns    = Clock_GetNow_ns();
+
+    // Fill the pipeline
+    for (i = 0; (DrvDMA_OK == lResult) && (i < aConfig.mBufferQty); i++)
+    {
+        lResult = Start(lBuffers + i, i, aConfig.mBufferSize_byte);
+    }
+
+    // Run the pipeline
+    for (i = aConfig.mBufferQty; (DrvDMA_OK == lResult) && (i < aConfig.mIteration); i++)
+    {
+        if ((nullptr != aConfig.mStop) && aConfig.mStop->load())
+        {
+            break;
+        }
+
+        auto lB = lBuffers + (i % aConfig.mBufferQty);
+
+        lResult = Wait(lB);
+        if (DrvDMA_OK == lResult)
+        {
+            lResult = Start(lB, i, aConfig.mBufferSize_byte);
+        }
+    }
+
+    unsigned int lDone = i;
+
+    // Purge the pipeline. The transfers already started must be waited on,
+    // even after an error, before the buffers are released.
+    for (unsigned int j = 0; j < aConfig.mBufferQty; j++)
+    {
+        auto lB = lBuffers + ((lDone + j) % aConfig.mBufferQty);
+        if (lB->mPending)
+        {
+            auto lRet = Wait(lB);
+            if (DrvDMA_OK == lResult)
+            {
+                lResult = lRet;
+            }
+        }
+    }
+
+    auto lStop_ns    = Clock_GetNow_ns();
+    auto lStopCpu_ns = Clock_GetThreadCpu_ns();
+
+    for (i = 0; i < aConfig.mBufferQty; i++)
+    {
+        Buffer_Free(lBuffers + i);
+    }
+
+    delete[] lBuffers;
+
+    mIntegrity = nullptr;
+    mTrace     = nullptr;
+
+    aResult->mCompletion  = mCompletion;
+    aResult->mCpu_ns      = lStopCpu_ns - lStartCpu_ns;
+    aResult->mDuration_ns = lStop_ns - lStart_ns;
+    aResult->mIteration   = lDone;
+    aResult->mStart_ns    = lStart_ns;
+
+    aResult->mStartTotal_ns = mStartTotal_ns;
+    aResult->mTotal_byte  = static_cast<uint64_t>(aConfig.mBufferSize_byte) * lDone;
+
+    return lResult;
+}
+
+double Pipeline::GetCpu_pct(const Result& aResult)
+{
+    double lResult = 0.0;
+
+    if (0 < aResult.mDuration_ns)
+    {
+        lResult = static_cast<double>(aResult.mCpu_ns);
+        lResult *= 100.0;
+        lResult /= aResult.mDuration_ns;
+    }
+
+    return lResult;
+}
+
+double Pipeline::GetSpeed_GB_s(const Result& aResult)
+{
+    double lResult = 0.0;
+
+    if (0 < aResult.mDuration_ns)
+    {
+        // byte / ns = GB / s
+        lResult = static_cast<double>(aResult.mTotal_byte);
+        lResult /= aResult.mDuration_ns;
+    }
+
+    return lResult;
+}
+
+double Pipeline::GetStartTime_us(const Result& aResult)
+{
+    double lResult = 0.0;
+
+    if (0 < aResult.mIteration)
+    {
+        lResult = static_cast<double>(aResult.mStartTotal_ns);
+        lResult /= aResult.mIteration;
+        lResult /= 1000.0;
+    }
+
+    return lResult;
+}
+
+double Pipeline::GetTransferRate_s(const Result& aResult)
+{
+    double lResult = 0.0;
+
+    if (0 < aResult.mDuration_ns)
+    {
+        lResult = aResult.mIteration;
+        lResult *= 1000000000.0;
+        lResult /= aResult.mDuration_ns;
+    }
+
+    return lResult;
+}
+
+double Pipeline::GetTransferTime_us(const Result& aResult)
+{
+    double lResult = 0.0;
+
+    if (0 < aResult.mIteration)
+    {
+        lResult = static_cast<double>(aResult.mDuration_ns);
+        lResult /= aResult.mIteration;
+        lResult /= 1000.0;
+    }
+
+    return lResult;
+}
+
+// Private
+// //////////////////////////////////////////////////////////////////////////
+
+void Pipeline::Buffer_Alloc(Buffer* aBuffer, unsigned int aSize_byte)
+{
+    aBuffer->mPending = false;
+
+    if (nullptr != mPool)
+    {
+        assert(mPool->GetBufferSize() >= aSize_byte);
+
+        aBuffer->mAligned   = mPool->Acquire();
+        aBuffer->mUnaligned = nullptr;
+        return;
+    }
+
+    auto lUnaligned = new uint8_t[aSize_byte + 64];
+
+    uint64_t lOffset_byte = 64 - (reinterpret_cast<uint64_t>(lUnaligned) % 64);
+
+    aBuffer->mAligned   = lUnaligned + lOffset_byte;
+    aBuffer->mUnaligned = lUnaligned;
+
+    memset(aBuffer->mAligned, 0, aSize_byte);
+}
+
+void Pipeline::Buffer_Check(Buffer* aBuffer)
+{
+    assert(nullptr != mIntegrity);
+    assert(INTEGRITY_ERROR_MAX >= mIntegrity->mErrorQty);
+
+    auto lBefore_ns = Clock_GetNow_ns();
+
+    auto lFree  = INTEGRITY_ERROR_MAX - mIntegrity->mErrorQty;
+    auto lCount = Pattern_Check(mIntegrity->mImpl, mIntegrity->mPattern, mIntegrity->mSeed, 0, aBuffer->mAligned, aBuffer->mSize_byte, mIntegrity->mErrors + mIntegrity->mErrorQty, lFree);
+
+    mIntegrity->mPattern_ns += Clock_GetNow_ns() - lBefore_ns;
+
+    mIntegrity->mErrorCount += lCount;
+    mIntegrity->mErrorQty   += (lFree < lCount) ? lFree : lCount;
+}
+
+void Pipeline::Buffer_Fill(Buffer* aBuffer)
+{
+    assert(nullptr != mIntegrity);
+
+    auto lBefore_ns = Clock_GetNow_ns();
+
+    Pattern_Fill(mIntegrity->mImpl, mIntegrity->mPattern, mIntegrity->mSeed, 0, aBuffer->mAligned, aBuffer->mSize_byte);
+
+    mIntegrity->mPattern_ns += Clock_GetNow_ns() - lBefore_ns;
+}
+
+// The DrvDMA API only offers the blocking Wait. To spin, Poll reads the
+// completed descriptor count of the channel. Calibrate runs each buffer
+// once alone to learn its descriptor count, then all the buffers at the
+// same time to verify the register counts them all.
+//
+// Return  false if the register cannot be used to detect the completions
+bool Pipeline::Calibrate(Buffer* aBuffers, unsigned int aQty, unsigned int aSize_byte)
+{
+    if (nullptr == mRegisters)
+    {
+        fprintf(stderr, "WARNING  The channel registers are not mapped, using DrvDMA::Wait\n");
+        return false;
+    }
+
+    uint32_t lCount = mRegisters[COMPLETED_DESC_COUNT];
+    uint32_t lTotal = 0;
+
+    unsigned int i;
+
+    for (i = 0; i < aQty; i++)
+    {
+        auto lB = aBuffers + i;
+
+        auto lRet = mDD->Start(mCI, mFromDevice, lB->mAligned, 0, mHardwareAddress, aSize_byte, &lB->mStatus);
+        if ((DrvDMA_OK_PENDING != lRet) || (DrvDMA_OK != mDD->Wait(&lB->mStatus)))
+        {
+            fprintf(stderr, "WARNING  Calibration transfer failed, using DrvDMA::Wait\n");
+            return false;
+        }
+
+        uint32_t lNow = mRegisters[COMPLETED_DESC_COUNT];
+
+        lB->mDescQty = lNow - lCount;
+        if (0 >= static_cast<int32_t>(lB->mDescQty))
+        {
+            fprintf(stderr, "WARNING  The completed descriptor count does not accumulate, using DrvDMA::Wait\n");
+            return false;
+        }
+
+        lCount  = lNow;
+        lTotal += lB->mDescQty;
+    }
+
+    bool lResult = true;
+
+    for (i = 0; lResult && (i < aQty); i++)
+    {
+        auto lB = aBuffers + i;
+
+        lResult = (DrvDMA_OK_PENDING == mDD->Start(mCI, mFromDevice, lB->mAligned, 0, mHardwareAddress, aSize_byte, &lB->mStatus));
+    }
+
+    // Only the transfers really started must be waited on.
+    auto lStarted = lResult ? aQty : (i - 1);
+
+    for (i = 0; i < lStarted; i++)
+    {
+        lResult = (DrvDMA_OK == mDD->Wait(&aBuffers[i].mStatus)) && lResult;
+    }
+
+    if (!lResult)
+    {
+        fprintf(stderr, "WARNING  Calibration transfer failed, using DrvDMA::Wait\n");
+        return false;
+    }
+
+    mDescEnd = mRegisters[COMPLETED_DESC_COUNT];
+
+    if (lCount + lTotal != mDescEnd)
+    {
+        fprintf(stderr, "WARNING  The completed descriptor count does not count the queued transfers, using DrvDMA::Wait\n");
+        return false;
+    }
+
+    return true;
+}
+
+void Pipeline::Buffer_Free(Buffer* aBuffer)
+{
+    if (nullptr != mPool)
+    {
+        mPool->Release(aBuffer->mAligned);
+        return;
+    }
+
+    auto lUnaligned = reinterpret_cast<uint8_t*>(aBuffer->mUnaligned);
+
+    delete[] lUnaligned;
+}
+
+// COMPLETION_POLL spins until the transfer is complete, COMPLETION_HYBRID
+// until it is complete or mSpin_ns elapsed. DrvDMA::Wait still retires
+// the transfer, but does not block once it is complete.
+void Pipeline::Poll(Buffer* aBuffer)
+{
+    assert(nullptr != mRegisters);
+
+    auto lLimit_ns = (COMPLETION_HYBRID == mCompletion) ? mSpin_ns : POLL_TIMEOUT_ns;
+    auto lStart_ns = Clock_GetNow_ns();
+
+    while (0 > static_cast<int32_t>(mRegisters[COMPLETED_DESC_COUNT] - aBuffer->mDescEnd))
+    {
+        if (lLimit_ns < Clock_GetNow_ns() - lStart_ns)
+        {
+            if (COMPLETION_POLL == mCompletion)
+            {
+                fprintf(stderr, "WARNING  Transfer %u not complete after 1 s of polling\n", aBuffer->mIndex);
+            }
+            break;
+        }
+    }
+}
+
+DrvDMA_Result Pipeline::Start(Buffer* aBuffer, unsigned int aIndex, unsigned int aSize_byte)
+{
+    aBuffer->mIndex     = aIndex;
+    aBuffer->mSize_byte = aSize_byte;
+
+    if (COMPLETION_WAIT != mCompletion)
+    {
+        mDescEnd += aBuffer->mDescQty;
+
+        aBuffer->mDescEnd = mDescEnd;
+    }
+
+    if ((nullptr != mIntegrity) && (!mFromDevice))
+    {
+        Buffer_Fill(aBuffer);
+    }
+
+    if (nullptr != mTrace)
+    {
+        mTrace->mStart_ns[aIndex] = Clock_GetNow_ns();
+    }
+
+    auto lBefore_ns = Clock_GetNow_ns();
+
+    auto lResult = mDD->Start(mCI, mFromDevice, aBuffer->mAligned, 0, mHardwareAddress, aSize_byte, &aBuffer->mStatus);
+
+    mStartTotal_ns += Clock_GetNow_ns() - lBefore_ns;
+    if (DrvDMA_OK_PENDING == lResult)
+    {
+        aBuffer->mPending = true;
+
+        lResult = DrvDMA_OK;
+    }
+    else
+    {
+        fprintf(stderr, "ERROR  DrvDMA::Start failed - %s\n", DrvDMA::GetResultName(lResult));
+    }
+
+    return lResult;
+}
+
+DrvDMA_Result Pipeline::Wait(Buffer* aBuffer)
+{
+    assert(aBuffer->mPending);
+
+    aBuffer->mPending = false;
+
+    if (COMPLETION_WAIT != mCompletion)
+    {
+        Poll(aBuffer);
+    }
+
+    auto lResult = mDD->Wait(&aBuffer->mStatus);
+
+    if (nullptr != mTrace)
+    {
+        mTrace->mDone_ns[aBuffer->mIndex] = Clock_GetNow_ns();
+    }
+
+    if (DrvDMA_OK != lResult)
+    {
+        fprintf(stderr, "ERROR  DrvDMA::Wait failed - %s\n", DrvDMA::GetResultName(lResult));
+    }
+    else if ((nullptr != mIntegrity) && mFromDevice)
+    {
+        Buffer_Check(aBuffer);
+    }
+
+    return lResult;
+}
@@ -0,0 +1,172 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Pipeline.h
+
+#pragma once
+
+// ===== Local ==============================================================
+#include "Options.h"
+#include "Pattern.h"
+
+class BufferPool;
+
+// The Start / Wait ring of U_XDMA_H2C_Perf, with the buffer count, the
+// buffer size, the iteration count and the direction given at run time.
+class Pipeline
+{
+
+public:
+
+    static const unsigned int INTEGRITY_ERROR_MAX = 8;
+
+    // The data pattern of the transfers. Each transfer holds the pattern
+    // from offset 0, as all the transfers use the same hardware address.
+    typedef struct
+    {
+        Pattern      mPattern;
+        Pattern_Impl mImpl;
+        uint32_t     mSeed;
+
+        // Output - The first mismatches and the total number of
+        // mismatching words
+        uint64_t      mErrorCount;
+        Pattern_Error mErrors[INTEGRITY_ERROR_MAX];
+        unsigned int  mErrorQty;
+
+        // Output - Time spent filling or checking the buffers
+        uint64_t mPattern_ns;
+    }
+    Integrity;
+
+    // Time stamps of each transfer, indexed by iteration. Each array has
+    // Config::mIteration entries.
+    typedef struct
+    {
+        uint64_t* mDone_ns;  // Wait returned
+        uint64_t* mStart_ns; // Just before Start
+    }
+    Trace;
+
+    typedef struct
+    {
+        unsigned int mBufferQty;
+        unsigned int mBufferSize_byte;
+        unsigned int mIteration;
+
+        // COMPLETION_POLL and COMPLETION_HYBRID need the registers, see
+        // SetRegisters. Run uses COMPLETION_WAIT when they are not usable.
+        Completion   mCompletion;
+        unsigned int mSpin_us;
+
+        // When not nullptr, Run stops starting new transfers as soon as
+        // the flag is set. Result::mIteration then gives the number of
+        // transfers really done.
+        const std::atomic<bool>* mStop;
+
+        // When not nullptr, Run fills each H2C buffer with the pattern
+        // before starting it, or checks each C2H buffer after its
+        // completion.
+        Integrity* mIntegrity;
+
+        // When not nullptr, Run records the time stamps of each transfer.
+        Trace* mTrace;
+    }
+    Config;
+
+    typedef struct
+    {
+        uint64_t mCpu_ns; // CPU time of the thread calling Run
+        uint64_t mDuration_ns;
+        uint64_t mStart_ns;
+        uint64_t mStartTotal_ns; // Time spent in the Start calls
+        uint64_t mTotal_byte;
+
+        // COMPLETION_WAIT when the registers were not usable
+        Completion   mCompletion;
+        unsigned int mIteration;
+    }
+    Result;
+
+    // aDD          The DrvDMA instance
+    // aCI          The logical index of the configured channel
+    // aFromDevice  true for C2H, false for H2C
+    // aHardwareAddress  The address on the internal AXI bus
+    Pipeline(DrvDMA* aDD, unsigned int aCI, bool aFromDevice, uint64_t aHardwareAddress);
+
+    ~Pipeline();
+
+    // aOptions  Create a BufferPool large enough for the largest depth and
+    //           transfer size, unless mAlloc is ALLOC_LEGACY
+    //
+    // Return  false if the allocation failed
+    bool Pool_Create(const Options& aOptions);
+
+    // aPool  The BufferPool to take the buffers from or nullptr to
+    //        allocate them for each run. The Pipeline instance takes
+    //        ownership of the BufferPool.
+    void SetPool(BufferPool* aPool);
+
+    // aChannel  The registers of the XDMA channel, see
+    //           Channel_GetRegisters
+    void SetRegisters(volatile uint32_t* aChannel);
+
+    // aConfig  The configuration of the run
+    // aResult [---;-W-] The measured duration and transfered size
+    //
+    // Return
+    //  DrvDMA_OK
+    //  ...        See DrvDMA::Start and DrvDMA::Wait
+    DrvDMA_Result Run(const Config& aConfig, Result* aResult);
+
+    static double GetCpu_pct        (const Result& aResult);
+    static double GetSpeed_GB_s     (const Result& aResult);
+    static double GetStartTime_us   (const Result& aResult);
+    static double GetTransferRate_s (const Result& aResult);
+    static double GetTransferTime_us(const Result& aResult);
+
+private:
+
+    typedef struct
+    {
+        void*        mAligned;
+        uint32_t     mDescEnd; // Completed descriptor count at the end
+        uint32_t     mDescQty; // Descriptors per transfer
+        unsigned int mIndex;
+        bool         mPending;
+        unsigned int mSize_byte;
+        void*        mUnaligned;
+
+        DrvDMA_Transfer_Status mStatus;
+    }
+    Buffer;
+
+    void Buffer_Alloc(Buffer* aBuffer, unsigned int aSize_byte);
+    void Buffer_Check(Buffer* aBuffer);
+    void Buffer_Fill (Buffer* aBuffer);
+    void Buffer_Free (Buffer* aBuffer);
+
+    bool Calibrate(Buffer* aBuffers, unsigned int aQty, unsigned int aSize_byte);
+
+    void Poll(Buffer* aBuffer);
+
+    DrvDMA_Result Start(Buffer* aBuffer, unsigned int aIndex, unsigned int aSize_byte);
+    DrvDMA_Result Wait (Buffer* aBuffer);
+
+    DrvDMA* mDD;
+
+    unsigned int mCI;
+    Completion   mCompletion;
+    uint32_t     mDescEnd;
+    bool         mFromDevice;
+    uint64_t     mHardwareAddress;
+    Integrity  * mIntegrity;
+    BufferPool * mPool;
+    uint64_t     mSpin_ns;
+    uint64_t     mStartTotal_ns;
+    Trace      * mTrace;
+
+    volatile uint32_t* mRegisters;
+
+};
@@ -0,0 +1,149 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Placement.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "Channel.h"
+#include "Numa.h"
+#include "Pipeline.h"
+#include "Report.h"
+
+#include "Modes.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+static const char* COLUMNS[] =
+{
+    "direction", "size_byte", "depth", "local_node", "remote_node", "local_GB_s", "remote_GB_s", "remote_penalty_pct", nullptr
+};
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static int Placement_Compare(DrvDMA* aDD, const Options& aOptions, bool aFromDevice, int aLocal, int aRemote, Report* aReport);
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+int Mode_Placement(DrvDMA* aDD, const Options& aOptions, FILE* aOut)
+{
+    int lLocal;
+    int lRemote;
+
+    if (!Numa_GetNodes(aDD, aOptions, &lLocal, &lRemote))
+    {
+        return __LINE__;
+    }
+
+    if (NUMA_NODE_ANY == lRemote)
+    {
+        fprintf(stderr, "ERROR  The system has only one NUMA node\n");
+        return __LINE__;
+    }
+
+    int lResult = 0;
+
+    Report lReport(aOut, aOptions.mFormat, COLUMNS);
+
+    if (0 != (aOptions.mDirections & DIRECTION_H2C))
+    {
+        lResult = Placement_Compare(aDD, aOptions, false, lLocal, lRemote, &lReport);
+    }
+
+    if ((0 == lResult) && (0 != (aOptions.mDirections & DIRECTION_C2H)))
+    {
+        lResult = Placement_Compare(aDD, aOptions, true, lLocal, lRemote, &lReport);
+    }
+
+    return lResult;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+// Each pipeline has its buffers on one node and the thread moves to that
+// node before each run, so the local and remote measures alternate.
+int Placement_Compare(DrvDMA* aDD, const Options& aOptions, bool aFromDevice, int aLocal, int aRemote, Report* aReport)
+{
+    auto lDirection = aFromDevice ? "C2H" : "H2C";
+
+    unsigned int lCI;
+
+    auto lRet = Channel_Open(aDD, aOptions, aFromDevice, 0, &lCI);
+    if (DrvDMA_OK != lRet)
+    {
+        return __LINE__;
+    }
+
+    int      lNodes[2] = { aLocal, aRemote };
+    Options  lOptions  = aOptions;
+    Pipeline lLocal (aDD, lCI, aFromDevice, aOptions.mHardwareAddress);
+    Pipeline lRemote(aDD, lCI, aFromDevice, aOptions.mHardwareAddress);
+
+    Pipeline* lPipelines[2] = { &lLocal, &lRemote };
+
+    for (unsigned int i = 0; i < 2; i++)
+    {
+        // The pool is touched, so placed, from the thread on its node.
+        lOptions.mNode = lNodes[i];
+
+        if ((!Numa_PinThread(lNodes[i])) || (!lPipelines[i]->Pool_Create(lOptions)))
+        {
+            return __LINE__;
+        }
+    }
+
+    for (auto lSize_byte = aOptions.mSizeMin_byte; lSize_byte <= aOptions.mSizeMax_byte; lSize_byte *= 2)
+    {
+        for (unsigned int d = 0; d < aOptions.mDepthQty; d++)
+        {
+            Pipeline::Config lConfig;
+            Pipeline::Result lResults[2];
+
+            lConfig.mBufferQty       = aOptions.mDepths[d];
+            lConfig.mBufferSize_byte = lSize_byte;
+            lConfig.mCompletion      = COMPLETION_WAIT;
+            lConfig.mIntegrity       = nullptr;
+            lConfig.mIteration       = Options_GetIteration(aOptions, lSize_byte, lConfig.mBufferQty);
+            lConfig.mSpin_us         = 0;
+            lConfig.mStop            = nullptr;
+            lConfig.mTrace           = nullptr;
+
+            fprintf(stderr, "%s - %u bytes - depth %u - %u iterations\n", lDirection, lSize_byte, lConfig.mBufferQty, lConfig.mIteration);
+
+            for (unsigned int i = 0; i < 2; i++)
+            {
+                if ((!Numa_PinThread(lNodes[i])) || (DrvDMA_OK != lPipelines[i]->Run(lConfig, lResults + i)))
+                {
+                    return __LINE__;
+                }
+            }
+
+            auto lLocal_GB_s  = Pipeline::GetSpeed_GB_s(lResults[0]);
+            auto lRemote_GB_s = Pipeline::GetSpeed_GB_s(lResults[1]);
+
+            aReport->Row_Begin();
+            aReport->Value(lDirection);
+            aReport->Value(static_cast<uint64_t>(lSize_byte));
+            aReport->Value(static_cast<uint64_t>(lConfig.mBufferQty));
+            aReport->Value(static_cast<uint64_t>(aLocal));
+            aReport->Value(static_cast<uint64_t>(aRemote));
+            aReport->Value(lLocal_GB_s);
+            aReport->Value(lRemote_GB_s);
+            aReport->Value((0.0 < lLocal_GB_s) ? (100.0 * (lLocal_GB_s - lRemote_GB_s) / lLocal_GB_s) : 0.0);
+            aReport->Row_End();
+        }
+
+        if (TRANSFER_SIZE_MAX_byte / 2 < lSize_byte)
+        {
+            break;
+        }
+    }
+
+    return 0;
+}
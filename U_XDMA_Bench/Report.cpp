@@ -0,0 +1,164 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Report.cpp
+
+#include "Component.h"
+
+// ===== C ==================================================================
+#include <inttypes.h>
+
+// ===== C++ ================================================================
+#include <algorithm>
+
+// ===== Local ==============================================================
+#include "Report.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+static const double PERCENTILES[] = { 50.0, 90.0, 99.0, 99.9 };
+
+// Public
+// //////////////////////////////////////////////////////////////////////////
+
+Report::Report(FILE* aOut, Format aFormat, const char** aColumns)
+    : mColumns(aColumns), mColumn(0), mFormat(aFormat), mOut(aOut), mRow(0)
+{
+    assert(nullptr != aOut);
+    assert(nullptr != aColumns);
+
+    switch (mFormat)
+    {
+    case FORMAT_CSV:
+        for (unsigned int i = 0; nullptr != mColumns[i]; i++)
+        {
+            fprintf(mOut, "%s%s", (0 == i) ? "" : ",", mColumns[i]);
+        }
+        fprintf(mOut, "\n");
+        break;
+
+    case FORMAT_JSON: fprintf(mOut, "["); break;
+
+    default: assert(false);
+    }
+
+    fflush(mOut);
+}
+
+Report::~Report()
+{
+    if (FORMAT_JSON == mFormat)
+    {
+        fprintf(mOut, "\n]\n");
+    }
+
+    fflush(mOut);
+}
+
+void Report::Row_Begin()
+{
+    assert(0 == mColumn);
+
+    if (FORMAT_JSON == mFormat)
+    {
+        fprintf(mOut, "%s\n  {", (0 == mRow) ? "" : ",");
+    }
+}
+
+void Report::Row_End()
+{
+    assert(nullptr == mColumns[mColumn]);
+
+    switch (mFormat)
+    {
+    case FORMAT_CSV : fprintf(mOut, "\n"); break;
+    case FORMAT_JSON: fprintf(mOut, " }"); break;
+
+    default: assert(false);
+    }
+
+    fflush(mOut);
+
+    mColumn = 0;
+    mRow++;
+}
+
+void Report::Value(const char* aValue)
+{
+    Separator();
+
+    switch (mFormat)
+    {
+    case FORMAT_CSV : fprintf(mOut, "%s"    , aValue); break;
+    case FORMAT_JSON: fprintf(mOut, "\"%s\"", aValue); break;
+
+    default: assert(false);
+    }
+}
+
+void Report::Value(double aValue)
+{
+    Separator();
+
+    fprintf(mOut, "%.6f", aValue);
+}
+
+void Report::Value(uint64_t aValue)
+{
+    Separator();
+
+    fprintf(mOut, "%" PRIu64, aValue);
+}
+
+void Report::Percentiles_us(uint64_t* aValues_ns, unsigned int aCount)
+{
+    std::sort(aValues_ns, aValues_ns + aCount);
+
+    for (auto lPercentile : PERCENTILES)
+    {
+        double lValue_us = 0.0;
+
+        if (0 < aCount)
+        {
+            auto lRank = static_cast<unsigned int>(lPercentile * aCount / 100.0 + 0.999999);
+            if (0 < lRank)
+            {
+                lRank--;
+            }
+
+            lValue_us = static_cast<double>(aValues_ns[lRank]) / 1000.0;
+        }
+
+        Value(lValue_us);
+    }
+
+    Value((0 < aCount) ? (static_cast<double>(aValues_ns[aCount - 1]) / 1000.0) : 0.0);
+}
+
+// Private
+// //////////////////////////////////////////////////////////////////////////
+
+void Report::Separator()
+{
+    assert(nullptr != mColumns[mColumn]);
+
+    switch (mFormat)
+    {
+    case FORMAT_CSV:
+        if (0 < mColumn)
+        {
+            fprintf(mOut, ",");
+        }
+        break;
+
+    case FORMAT_JSON:
+        fprintf(mOut, "%s \"%s\": ", (0 == mColumn) ? "" : ",", mColumns[mColumn]);
+        break;
+
+    default: assert(false);
+    }
+
+    mColumn++;
+}
@@ -0,0 +1,51 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Report.h
+
+#pragma once
+
+// ===== Local ==============================================================
+#include "Options.h"
+
+// Write a table of results as CSV (one header line, then one line per row)
+// or as JSON (an array of objects using the column names as keys).
+class Report
+{
+
+public:
+
+    // aOut      The output stream
+    // aFormat   FORMAT_CSV or FORMAT_JSON
+    // aColumns  The column names, terminated by nullptr
+    Report(FILE* aOut, Format aFormat, const char** aColumns);
+
+    ~Report();
+
+    void Row_Begin();
+    void Row_End();
+
+    // The value must be added in the column order.
+    void Value(const char* aValue);
+    void Value(double      aValue);
+    void Value(uint64_t    aValue);
+
+    // Add 5 values, the 50, 90, 99 and 99.9 percentiles and the maximum,
+    // in us, using the nearest rank method.
+    //
+    // aValues_ns  The values, sorted in place
+    // aCount      The number of values
+    void Percentiles_us(uint64_t* aValues_ns, unsigned int aCount);
+
+private:
+
+    void Separator();
+
+    const char** mColumns;
+    unsigned int mColumn;
+    Format       mFormat;
+    FILE       * mOut;
+    unsigned int mRow;
+
+};
@@ -0,0 +1,118 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/Sweep.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "Channel.h"
+#include "Pipeline.h"
+#include "Report.h"
+
+#include "Modes.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+static const char* COLUMNS[] =
+{
+    "direction", "size_byte", "depth", "iteration", "duration_s", "speed_GB_s", "transfer_s", "transfer_us", nullptr
+};
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static int Sweep(DrvDMA* aDD, const Options& aOptions, bool aFromDevice, Report* aReport);
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+int Mode_Sweep(DrvDMA* aDD, const Options& aOptions, FILE* aOut)
+{
+    int lResult = 0;
+
+    Report lReport(aOut, aOptions.mFormat, COLUMNS);
+
+    if (0 != (aOptions.mDirections & DIRECTION_H2C))
+    {
+        lResult = Sweep(aDD, aOptions, false, &lReport);
+    }
+
+    if ((0 == lResult) && (0 != (aOptions.mDirections & DIRECTION_C2H)))
+    {
+        lResult = Sweep(aDD, aOptions, true, &lReport);
+    }
+
+    return lResult;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+int Sweep(DrvDMA* aDD, const Options& aOptions, bool aFromDevice, Report* aReport)
+{
+    auto lDirection = aFromDevice ? "C2H" : "H2C";
+
+    unsigned int lCI;
+
+    auto lRet = Channel_Open(aDD, aOptions, aFromDevice, 0, &lCI);
+    if (DrvDMA_OK != lRet)
+    {
+        return __LINE__;
+    }
+
+    Pipeline lPipeline(aDD, lCI, aFromDevice, aOptions.mHardwareAddress);
+
+    lPipeline.SetRegisters(Channel_GetRegisters(aDD, aOptions, aFromDevice, 0));
+
+    if (!lPipeline.Pool_Create(aOptions))
+    {
+        return __LINE__;
+    }
+
+    for (auto lSize_byte = aOptions.mSizeMin_byte; lSize_byte <= aOptions.mSizeMax_byte; lSize_byte *= 2)
+    {
+        for (unsigned int d = 0; d < aOptions.mDepthQty; d++)
+        {
+            Pipeline::Config lConfig;
+            Pipeline::Result lResult;
+
+            lConfig.mBufferQty       = aOptions.mDepths[d];
+            lConfig.mBufferSize_byte = lSize_byte;
+            lConfig.mCompletion      = aOptions.mCompletion;
+            lConfig.mIntegrity       = nullptr;
+            lConfig.mIteration       = Options_GetIteration(aOptions, lSize_byte, lConfig.mBufferQty);
+            lConfig.mSpin_us         = aOptions.mSpin_us;
+            lConfig.mStop            = nullptr;
+            lConfig.mTrace           = nullptr;
+
+            fprintf(stderr, "%s - %u bytes - depth %u - %u iterations\n", lDirection, lSize_byte, lConfig.mBufferQty, lConfig.mIteration);
+
+            lRet = lPipeline.Run(lConfig, &lResult);
+            if (DrvDMA_OK != lRet)
+            {
+                return __LINE__;
+            }
+
+            aReport->Row_Begin();
+            aReport->Value(lDirection);
+            aReport->Value(static_cast<uint64_t>(lSize_byte));
+            aReport->Value(static_cast<uint64_t>(lConfig.mBufferQty));
+            aReport->Value(static_cast<uint64_t>(lResult.mIteration));
+            aReport->Value(static_cast<double>(lResult.mDuration_ns) / 1000000000.0);
+            aReport->Value(Pipeline::GetSpeed_GB_s     (lResult));
+            aReport->Value(Pipeline::GetTransferRate_s (lResult));
+            aReport->Value(Pipeline::GetTransferTime_us(lResult));
+            aReport->Row_End();
+        }
+
+        if (TRANSFER_SIZE_MAX_byte / 2 < lSize_byte)
+        {
+            break;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,443 @@
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   DrvDMA
+// File      U_XDMA_Bench/U_XDMA_Bench.cpp
+
+// Usage  U_XDMA_Bench [Mode] [--Option=Value] ...
+//
+// Modes
+//  alloc      Compare the throughput and the Start cost of the legacy
+//             allocator with the page and huge page buffer pools
+//  channels   Run 1 to --channels H2C and / or C2H channels at the same
+//             time, one thread per channel, and report the throughput of
+//             each channel and the aggregate
+//  checker    Measure the pattern fill and check speed of each SIMD
+//             implementation on one core, without DMA
+//  completion Compare DrvDMA::Wait with spinning on the completed
+//             descriptor count of the channel, and with spinning up to
+//             --spin-us before calling Wait: throughput, CPU use and
+//             completion latency
+//  duplex     Run a H2C and a C2H pipeline at the same time, for each
+//             transfer size and pipeline depth, and compare with each
+//             direction running alone
+//  gather     Compare copying 2, 8 or 64 fragments in a staging buffer
+//             with starting one transfer per fragment, one packet in
+//             flight
+//  integrity  Fill the H2C buffers with the pattern, check the C2H
+//             buffers reading it back from --hw-address and compare the
+//             throughput with the one without pattern
+//  large      Transfer --large-size frames split in --size-max chunks by
+//             the LargeTransfer class and compare with a hand-written
+//             pipeline of --size-max transfers
+//  latency    Time stamp each Start and the matching Wait completion and
+//             report percentiles and histograms of the completion
+//             latency and of the gap between completions
+//  placement  Compare the throughput with the buffers and the thread on
+//             the NUMA node of the device and on another node
+//  sweep      Measure the throughput for each transfer size, pipeline
+//             depth and direction (default)
+//
+// Options
+//  --alloc=A            huge, page or legacy (huge)
+//  --bar=N              Logical index of the XDMA register BAR (1)
+//  --channels=N         Channel count per direction, 1 to 4 (4)
+//  --bytes=N            Bytes to transfer for each measure (1 GiB)
+//  --completion=C       wait, poll or hybrid, for the latency and sweep
+//                       modes (wait)
+//  --depth=N[,N...]     Pipeline depths (2,4,8,16)
+//  --device=N           Index of the driver instance (0)
+//  --direction=D        h2c, c2h or both (both)
+//  --format=F           csv or json (csv)
+//  --hw-address=N       Address on the internal AXI bus (0)
+//  --iteration-min=N    Minimum iteration count for each measure (16)
+//  --large-size=N       Logical transfer size of the large mode (256 MiB)
+//  --numa=P             any, local or remote, where to place the buffers
+//                       and the threads of the other modes (any)
+//  --numa-node=N        NUMA node of the device (found on Linux)
+//  --output=File        Write the result table to this file (stdout)
+//  --pattern=P          counter or random (random)
+//  --seed=N             Seed of the pattern (0x12345678)
+//  --sim                Use the DrvDMA_SIM engine, no driver needed
+//  --size-max=N         Largest transfer size (32 MiB)
+//  --size-min=N         Smallest transfer size (4 KiB)
+//  --spin-us=N          Longest spin of the hybrid completion (20)
+//  --stall-us=N         Gap between completions reported as stall (1000)
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "Channel.h"
+#include "Modes.h"
+#include "Numa.h"
+#include "Options.h"
+
+// Configurations
+// //////////////////////////////////////////////////////////////////////////
+
+#define DEFAULT_BAR             (1)
+#define DEFAULT_BYTES           (1024 * 1024 * 1024)
+#define DEFAULT_DEVICE          (0)
+#define DEFAULT_ITERATION_MIN   (16)
+#define DEFAULT_LARGE_SIZE_byte (256 * 1024 * 1024)
+#define DEFAULT_SEED            (0x12345678)
+#define DEFAULT_SIZE_MIN_byte   (4 * 1024)
+#define DEFAULT_SPIN_us         (20)
+#define DEFAULT_STALL_us        (1000)
+
+static const unsigned int DEFAULT_DEPTHS[] = { 2, 4, 8, 16 };
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static bool Options_Parse(Options* aOptions, int aCount, const char** aVector);
+
+static bool ParseDepths(const char* aIn, Options* aOptions);
+static bool ParseInt   (const char* aIn, int* aOut);
+static bool ParseUInt64(const char* aIn, uint64_t* aOut);
+static bool ParseUInt  (const char* aIn, unsigned int* aOut);
+
+// Entry point
+// //////////////////////////////////////////////////////////////////////////
+
+int main(int aCount, const char** aVector)
+{
+    Options lOptions;
+
+    if (!Options_Parse(&lOptions, aCount, aVector))
+    {
+        fprintf(stderr, "USAGE  U_XDMA_Bench [Mode] [--Option=Value] ...\n");
+        return __LINE__;
+    }
+
+    auto lOut = stdout;
+
+    if (nullptr != lOptions.mOutput)
+    {
+        #ifdef _KMS_LINUX_
+            lOut = fopen(lOptions.mOutput, "w");
+        #endif
+
+        #ifdef _KMS_WINDOWS_
+            if (0 != fopen_s(&lOut, lOptions.mOutput, "w"))
+            {
+                lOut = nullptr;
+            }
+        #endif
+
+        if (nullptr == lOut)
+        {
+            fprintf(stderr, "ERROR  Cannot open %s\n", lOptions.mOutput);
+            return __LINE__;
+        }
+    }
+
+    int lResult = __LINE__;
+
+    auto lDD = DrvDMA::Create();
+    if (nullptr != lDD)
+    {
+        auto lRet = DrvDMA_OK;
+
+        // The DrvDMA_SIM engine does not need the driver, see U_Simple.
+        if (!lOptions.mSimulate)
+        {
+            lRet = lDD->Connect(lOptions.mDevice);
+        }
+
+        if (DrvDMA_OK == lRet)
+        {
+            if (!Numa_Place(lDD, &lOptions))
+            {
+                fprintf(stderr, "ERROR  NUMA placement failed\n");
+            }
+            else if (0 == strcmp("alloc", lOptions.mMode))
+            {
+                lResult = Mode_Alloc(lDD, lOptions, lOut);
+            }
+            else if (0 == strcmp("channels", lOptions.mMode))
+            {
+                lResult = Mode_Channels(lDD, lOptions, lOut);
+            }
+            else if (0 == strcmp("checker", lOptions.mMode))
+            {
+                lResult = Mode_Checker(lDD, lOptions, lOut);
+            }
+            else if (0 == strcmp("completion", lOptions.mMode))
+            {
+                lResult = Mode_Completion(lDD, lOptions, lOut);
+            }
+            else if (0 == strcmp("duplex", lOptions.mMode))
+            {
+                lResult = Mode_Duplex(lDD, lOptions, lOut);
+            }
+            else if (0 == strcmp("gather", lOptions.mMode))
+            {
+                lResult = Mode_Gather(lDD, lOptions, lOut);
+            }
+            else if (0 == strcmp("integrity", lOptions.mMode))
+            {
+                lResult = Mode_Integrity(lDD, lOptions, lOut);
+            }
+            else if (0 == strcmp("large", lOptions.mMode))
+            {
+                lResult = Mode_Large(lDD, lOptions, lOut);
+            }
+            else if (0 == strcmp("latency", lOptions.mMode))
+            {
+                lResult = Mode_Latency(lDD, lOptions, lOut);
+            }
+            else if (0 == strcmp("placement", lOptions.mMode))
+            {
+                lResult = Mode_Placement(lDD, lOptions, lOut);
+            }
+            else if (0 == strcmp("sweep", lOptions.mMode))
+            {
+                lResult = Mode_Sweep(lDD, lOptions, lOut);
+            }
+            else
+            {
+                fprintf(stderr, "ERROR  Unknown mode - %s\n", lOptions.mMode);
+            }
+
+            if (!lOptions.mSimulate)
+            {
+                lDD->Disconnect();
+            }
+        }
+        else
+        {
+            fprintf(stderr, "ERROR  DrvDMA::Connect failed - %s\n", DrvDMA::GetResultName(lRet));
+        }
+
+        lDD->Delete();
+    }
+    else
+    {
+        fprintf(stderr, "ERROR  DrvDMA::Create failed\n");
+    }
+
+    if (stdout != lOut)
+    {
+        fclose(lOut);
+    }
+
+    return lResult;
+}
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+unsigned int Options_GetDepthMax(const Options& aOptions)
+{
+    unsigned int lResult = 0;
+
+    for (unsigned int i = 0; i < aOptions.mDepthQty; i++)
+    {
+        if (lResult < aOptions.mDepths[i])
+        {
+            lResult = aOptions.mDepths[i];
+        }
+    }
+
+    return lResult;
+}
+
+unsigned int Options_GetIteration(const Options& aOptions, unsigned int aSize_byte, unsigned int aDepth)
+{
+    assert(0 < aSize_byte);
+
+    uint64_t lResult = aOptions.mBytes / aSize_byte;
+
+    if (aOptions.mIterationMin > lResult)
+    {
+        lResult = aOptions.mIterationMin;
+    }
+
+    // Run() needs at least one iteration per buffer.
+    if (aDepth > lResult)
+    {
+        lResult = aDepth;
+    }
+
+    return static_cast<unsigned int>(lResult);
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+bool Options_Parse(Options* aOptions, int aCount, const char** aVector)
+{
+    memset(aOptions, 0, sizeof(*aOptions));
+
+    aOptions->mAlloc          = ALLOC_HUGE;
+    aOptions->mBAR            = DEFAULT_BAR;
+    aOptions->mBytes          = DEFAULT_BYTES;
+    aOptions->mChannelQty     = XDMA_CHANNEL_QTY;
+    aOptions->mCompletion     = COMPLETION_WAIT;
+    aOptions->mDevice         = DEFAULT_DEVICE;
+    aOptions->mDeviceNode     = NUMA_NODE_ANY;
+    aOptions->mDirections     = DIRECTION_C2H | DIRECTION_H2C;
+    aOptions->mFormat         = FORMAT_CSV;
+    aOptions->mIterationMin   = DEFAULT_ITERATION_MIN;
+    aOptions->mLargeSize_byte = DEFAULT_LARGE_SIZE_byte;
+    aOptions->mMode           = "sweep";
+    aOptions->mNode           = NUMA_NODE_ANY;
+    aOptions->mPattern        = PATTERN_RANDOM;
+    aOptions->mPlacement      = PLACEMENT_ANY;
+    aOptions->mSeed           = DEFAULT_SEED;
+    aOptions->mSizeMax_byte   = TRANSFER_SIZE_MAX_byte;
+    aOptions->mSizeMin_byte   = DEFAULT_SIZE_MIN_byte;
+    aOptions->mSpin_us        = DEFAULT_SPIN_us;
+    aOptions->mStall_us       = DEFAULT_STALL_us;
+
+    aOptions->mDepthQty = sizeof(DEFAULT_DEPTHS) / sizeof(DEFAULT_DEPTHS[0]);
+    memcpy(aOptions->mDepths, DEFAULT_DEPTHS, sizeof(DEFAULT_DEPTHS));
+
+    for (int i = 1; i < aCount; i++)
+    {
+        auto lArg = aVector[i];
+        bool lOK  = true;
+
+        if ('-' != lArg[0])
+        {
+            aOptions->mMode = lArg;
+        }
+        else if (0 == strcmp("--sim", lArg))
+        {
+            aOptions->mSimulate = true;
+        }
+        else if (0 == strncmp("--bar="          , lArg,  6)) { lOK = ParseUInt  (lArg +  6, &aOptions->mBAR); }
+        else if (0 == strncmp("--bytes="        , lArg,  8)) { lOK = ParseUInt64(lArg +  8, &aOptions->mBytes); }
+        else if (0 == strncmp("--channels="     , lArg, 11)) { lOK = ParseUInt  (lArg + 11, &aOptions->mChannelQty); }
+        else if (0 == strncmp("--depth="        , lArg,  8)) { lOK = ParseDepths(lArg +  8, aOptions); }
+        else if (0 == strncmp("--device="       , lArg,  9)) { lOK = ParseUInt  (lArg +  9, &aOptions->mDevice); }
+        else if (0 == strncmp("--hw-address="   , lArg, 13)) { lOK = ParseUInt64(lArg + 13, &aOptions->mHardwareAddress); }
+        else if (0 == strncmp("--iteration-min=", lArg, 16)) { lOK = ParseUInt  (lArg + 16, &aOptions->mIterationMin); }
+        else if (0 == strncmp("--large-size="   , lArg, 13)) { lOK = ParseUInt  (lArg + 13, &aOptions->mLargeSize_byte); }
+        else if (0 == strncmp("--numa-node="    , lArg, 12)) { lOK = ParseInt   (lArg + 12, &aOptions->mDeviceNode); }
+        else if (0 == strncmp("--output="       , lArg,  9)) { aOptions->mOutput = lArg + 9; }
+        else if (0 == strncmp("--seed="         , lArg,  7)) { lOK = ParseUInt  (lArg +  7, &aOptions->mSeed); }
+        else if (0 == strncmp("--size-max="     , lArg, 11)) { lOK = ParseUInt  (lArg + 11, &aOptions->mSizeMax_byte); }
+        else if (0 == strncmp("--size-min="     , lArg, 11)) { lOK = ParseUInt  (lArg + 11, &aOptions->mSizeMin_byte); }
+        else if (0 == strncmp("--spin-us="      , lArg, 10)) { lOK = ParseUInt  (lArg + 10, &aOptions->mSpin_us); }
+        else if (0 == strncmp("--stall-us="     , lArg, 11)) { lOK = ParseUInt  (lArg + 11, &aOptions->mStall_us); }
+        else if (0 == strcmp("--alloc=huge"       , lArg)) { aOptions->mAlloc = ALLOC_HUGE; }
+        else if (0 == strcmp("--alloc=legacy"     , lArg)) { aOptions->mAlloc = ALLOC_LEGACY; }
+        else if (0 == strcmp("--alloc=page"       , lArg)) { aOptions->mAlloc = ALLOC_PAGE; }
+        else if (0 == strcmp("--completion=hybrid", lArg)) { aOptions->mCompletion = COMPLETION_HYBRID; }
+        else if (0 == strcmp("--completion=poll"  , lArg)) { aOptions->mCompletion = COMPLETION_POLL; }
+        else if (0 == strcmp("--completion=wait"  , lArg)) { aOptions->mCompletion = COMPLETION_WAIT; }
+        else if (0 == strcmp("--direction=both"   , lArg)) { aOptions->mDirections = DIRECTION_C2H | DIRECTION_H2C; }
+        else if (0 == strcmp("--direction=c2h"    , lArg)) { aOptions->mDirections = DIRECTION_C2H; }
+        else if (0 == strcmp("--direction=h2c"    , lArg)) { aOptions->mDirections = DIRECTION_H2C; }
+        else if (0 == strcmp("--format=csv"       , lArg)) { aOptions->mFormat = FORMAT_CSV; }
+        else if (0 == strcmp("--format=json"      , lArg)) { aOptions->mFormat = FORMAT_JSON; }
+        else if (0 == strcmp("--numa=any"         , lArg)) { aOptions->mPlacement = PLACEMENT_ANY; }
+        else if (0 == strcmp("--numa=local"       , lArg)) { aOptions->mPlacement = PLACEMENT_LOCAL; }
+        else if (0 == strcmp("--numa=remote"      , lArg)) { aOptions->mPlacement = PLACEMENT_REMOTE; }
+        else if (0 == strcmp("--pattern=counter"  , lArg)) { aOptions->mPattern = PATTERN_COUNTER; }
+        else if (0 == strcmp("--pattern=random"   , lArg)) { aOptions->mPattern = PATTERN_RANDOM; }
+        else
+        {
+            lOK = false;
+        }
+
+        if (!lOK)
+        {
+            fprintf(stderr, "ERROR  Invalid argument - %s\n", lArg);
+            return false;
+        }
+    }
+
+    if ((0 == aOptions->mSizeMin_byte) || (aOptions->mSizeMin_byte > aOptions->mSizeMax_byte) || (TRANSFER_SIZE_MAX_byte < aOptions->mSizeMax_byte))
+    {
+        fprintf(stderr, "ERROR  The transfer size must be between 1 byte and %u bytes\n", TRANSFER_SIZE_MAX_byte);
+        return false;
+    }
+
+    if (0 == aOptions->mLargeSize_byte)
+    {
+        fprintf(stderr, "ERROR  The large transfer size must not be 0\n");
+        return false;
+    }
+
+    if ((0 == aOptions->mChannelQty) || (XDMA_CHANNEL_QTY < aOptions->mChannelQty))
+    {
+        fprintf(stderr, "ERROR  The channel count must be between 1 and %u\n", XDMA_CHANNEL_QTY);
+        return false;
+    }
+
+    return true;
+}
+
+bool ParseDepths(const char* aIn, Options* aOptions)
+{
+    aOptions->mDepthQty = 0;
+
+    auto lPtr = aIn;
+
+    for (;;)
+    {
+        if (DEPTH_QTY_MAX <= aOptions->mDepthQty)
+        {
+            return false;
+        }
+
+        char* lEnd;
+
+        auto lValue = strtoul(lPtr, &lEnd, 0);
+        if ((lPtr == lEnd) || (0 == lValue))
+        {
+            return false;
+        }
+
+        aOptions->mDepths[aOptions->mDepthQty] = lValue;
+        aOptions->mDepthQty++;
+
+        if ('\0' == *lEnd)
+        {
+            break;
+        }
+
+        if (',' != *lEnd)
+        {
+            return false;
+        }
+
+        lPtr = lEnd + 1;
+    }
+
+    return true;
+}
+
+bool ParseInt(const char* aIn, int* aOut)
+{
+    uint64_t lValue;
+
+    auto lResult = ParseUInt64(aIn, &lValue) && (INT32_MAX >= lValue);
+
+    *aOut = static_cast<int>(lValue);
+
+    return lResult;
+}
+
+bool ParseUInt64(const char* aIn, uint64_t* aOut)
+{
+    char* lEnd;
+
+    *aOut = strtoull(aIn, &lEnd, 0);
+
+    return (aIn != lEnd) && ('\0' == *lEnd);
+}
+
+bool ParseUInt(const char* aIn, unsigned int* aOut)
+{
+    uint64_t lValue;
+
+    auto lResult = ParseUInt64(aIn, &lValue) && (UINT32_MAX >= lValue);
+
+    *aOut = static_cast<unsigned int>(lValue);
+
+    return lResult;
+}